@@ -13,6 +13,7 @@ import argparse
 import sst
 
 parser = argparse.ArgumentParser(description="Run chkpnt-param-2comp")
+parser.add_argument("--verbose", type=int, help="Verbosity (1 reports the traffic digest)", default=0)
 parser.add_argument("--numPorts", type=int, help="Number of ports per component", default=1)
 parser.add_argument("--minData", type=int, help="Minimum number of unsigned data elements", default=1)
 parser.add_argument("--maxData", type=int, help="Maximum number of unsigned data elements", default=2)
@@ -27,7 +28,7 @@ for arg in vars(args):
   print("\t", arg, " = ", getattr(args, arg))
 
 cp_params = {
-    "verbose" : 0,
+    "verbose" : args.verbose,
     "numPorts" : args.numPorts,
     "minData" : args.minData,
     "maxData" : args.maxData,
@@ -0,0 +1,53 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+
+# usage:   ./restart-verify.sh [period] [chkpnt-param-2comp.py options]
+#   period defaults to 1us
+# example: ./restart-verify.sh 2us --numPorts 8 --maxData 1024 --clocks 10000
+
+# Runs chkpnt-param-2comp.py once with checkpoints enabled and restarts from
+# every checkpoint.  Each component reports a rolling hash of all traffic it
+# sent and received at finish; the restarted runs must reproduce the digests
+# of the base run.  Receiving components also check every payload, so a
+# divergent restart fails with a fatal error before reaching finish.
+
+PERIOD=${1:-1us}
+MC_LIB_PATH="../../build/components/chkpnt"
+TEST="chkpnt-param-2comp.py"
+PFX=restart-verify
+OPTS="--verbose 1 ${@:2}"
+
+/bin/rm -rf $PFX $PFX.*.log
+sst --add-lib-path=$MC_LIB_PATH --checkpoint-period=$PERIOD --checkpoint-prefix=$PFX \
+  --model-options="$OPTS" $TEST > $PFX.base.log 2>&1 || { cat $PFX.base.log; exit 1; }
+base=$(grep -h "digest=" $PFX.base.log | sed 's/^.*\]: //' | sort)
+if [[ -z "$base" ]]; then
+  echo "no digests reported by the base run"
+  exit 1
+fi
+
+rc=0
+n=0
+for cpt in $(find $PFX -name '*.sstcpt' | sort -V)
+do
+  n=$((n + 1))
+  log=$PFX.$(basename $cpt .sstcpt).log
+  sst --add-lib-path=$MC_LIB_PATH --load-checkpoint $cpt > $log 2>&1
+  rst=$(grep -h "digest=" $log | sed 's/^.*\]: //' | sort)
+  if [[ "$base" != "$rst" ]]; then
+    echo "MISMATCH: restart from $cpt (see $log)"
+    rc=1
+  else
+    echo "OK: restart from $cpt"
+  fi
+done
+
+echo "verified $n restarts against the base run"
+exit $rc
+
+#EOF
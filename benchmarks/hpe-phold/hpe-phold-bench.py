@@ -110,6 +110,12 @@ def build_parser() -> argparse.ArgumentParser:
         default=0,
         help="Size of the additional data field of the component in bytes",
     )
+    parser.add_argument(
+        "--componentTouchFraction", '--component-touch-fraction',
+        type=float,
+        default=1.0,
+        help="Fraction of componentSize pages written at startup [0,1]",
+    )
     parser.add_argument(
         "--verbose",
         type=int,
@@ -184,6 +190,7 @@ def create_component(i: int, j: int, args, rows_per_rank: int, num_ranks: int,
             "largeEventFraction": args.largeEventFraction,
             "verbose": args.verbose,
             "componentSize": args.componentSize,
+            "componentTouchFraction": args.componentTouchFraction,
         }
     )
     comp.setRank(
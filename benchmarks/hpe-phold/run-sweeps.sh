@@ -170,7 +170,7 @@ SELECT
   global_max_rss, global_max_sync_data_size, global_max_tv_depth, global_mempool_size,
   global_pf, global_sync_data_size, local_max_pf, local_max_rss, max_build_time,
   max_mempool_size, max_run_time, max_total_time, ranks, simulated_time_ua,
-  clocks, componentSize, eventDensity, height, imbalance_factor, largeEventFraction,
+  clocks, componentSize, componentTouchFraction, eventDensity, height, imbalance_factor, largeEventFraction,
   largePayload, numRings, smallPayload, verbose, width  
 FROM
   raw;
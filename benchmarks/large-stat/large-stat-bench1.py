@@ -9,6 +9,7 @@
 #
 
 import os
+import sys
 import argparse
 import sst
 
@@ -16,8 +17,28 @@ parser = argparse.ArgumentParser(description="Run LargeStat Test2")
 parser.add_argument("--numComps", type=int, help="Number of cores to load", default=1)
 parser.add_argument("--numStats", type=int, help="Number of stats to load", default=1)
 parser.add_argument("--verbose", type=int, help="verbosity level", default=1)
+parser.add_argument("--numClocks", type=int, help="Number of clocks to run", default=1)
+parser.add_argument("--sampleMode", type=str, help="Stats sampled each tick: none|all|random|roundrobin", default="none")
+parser.add_argument("--samplesPerTick", type=int, help="Samples per tick (random, roundrobin)", default=1)
+parser.add_argument("--statType", type=str, help="Statistic type: accumulator|histogram|uniquecount", default="accumulator")
+parser.add_argument("--dumpPeriod", type=int, help="Cycles between statistic dumps (0 disables)", default=0)
+parser.add_argument("--chkpnt", type=int, help="Use the checkpointable LargeStatChkpnt component", default=0)
+parser.add_argument("--registerMode", type=str, help="Statistic registration mode: eager|lazy|vector", default="eager")
 args = parser.parse_args()
 
+statTypes = {
+  "accumulator" : {"type" : "sst.AccumulatorStatistic"},
+  "histogram"   : {"type" : "sst.HistogramStatistic",
+                   "minvalue" : "0",
+                   "binwidth" : "64",
+                   "numbins"  : "16",
+                   "IncludeOutOfBounds" : "1"},
+  "uniquecount" : {"type" : "sst.UniqueCountStatistic"},
+}
+if args.statType not in statTypes:
+  print(f"Unknown statType: {args.statType}")
+  sys.exit(-1)
+
 
 print("LargeStat Test 2 SST Simulation Configuration:")
 for arg in vars(args):
@@ -25,13 +46,32 @@ for arg in vars(args):
 
 #-- create all the cores + links
 for comp in range(args.numComps):
-    core = sst.Component("c_" + str(comp), "largestat.LargeStat")
+    core = sst.Component("c_" + str(comp),
+                         "largestatchkpnt.LargeStatChkpnt" if args.chkpnt else "largestat.LargeStat")
     core.addParams({
         "verbose" : args.verbose,
         "numStats" : args.numStats,
+        "numClocks" : args.numClocks,
+        "dumpPeriod" : args.dumpPeriod,
     })
+    # sampling and registration modes are LargeStat only
+    if not args.chkpnt:
+        core.addParams({
+            "sampleMode" : args.sampleMode,
+            "samplesPerTick" : args.samplesPerTick,
+            "registerMode" : args.registerMode,
+        })
 
 sst.setStatisticLoadLevel(10)
 sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./large-stat-test2.csv"})
-sst.enableAllStatisticsForAllComponents()
+if args.registerMode == "vector":
+  # one bin per statistic number
+  sst.enableStatisticForComponentType("largestat.LargeStat", "STAT_VEC",
+                                      {"type" : "sst.HistogramStatistic",
+                                       "minvalue" : "0",
+                                       "binwidth" : "1",
+                                       "numbins"  : str(args.numStats),
+                                       "IncludeOutOfBounds" : "0"})
+else:
+  sst.enableAllStatisticsForAllComponents(statTypes[args.statType])
 # EOF
@@ -0,0 +1,64 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# Measures the checkpoint cost of LargeStatChkpnt statistics.  For each
+# statistic count a single checkpoint is written and the size of the
+# checkpoint and the bytes contributed by the statistics vector are recorded
+# along with the marginal bytes per statistic relative to the previous step.
+# The checkpoint is then restarted, which verifies the statistic contents.
+#
+# usage: ./large-stat-chkpnt-cost.sh [startStats] [endStats]
+
+STATS=${1:-100}
+ENDSTATS=${2:-1000000}
+CLOCKS=2000
+LIB_PATH="../../build/components/large-stat-chkpnt"
+TEST="./large-stat-bench1.py"
+PFX="cost"
+
+FILE="chkpnt-cost.$STATS.$ENDSTATS.out"
+
+echo "START TEST: $STATS to $ENDSTATS statistics"
+echo "# numStats cpt_bytes stat_bytes bytesPerStat marginalBytesPerStat save_s restart_s" > $FILE
+
+last_stats=0
+last_bytes=0
+while [ $STATS -le $ENDSTATS ]
+do
+  echo "...checkpointing $STATS statistics"
+  rm -Rf $PFX *.csv
+  starttime=`date +%s.%N`
+  out=$(sst --add-lib-path=$LIB_PATH --checkpoint-prefix=$PFX --checkpoint-period=1us \
+    --model-options="--numComps 1 --numStats $STATS --numClocks $CLOCKS --chkpnt 1" $TEST)
+  endtime=`date +%s.%N`
+  save=$( echo "$endtime - $starttime" | bc -l )
+
+  cpt=$(find $PFX -name "*.sstcpt" | sort | head -1)
+  bytes=$(du -sb $(dirname $cpt) | cut -f1)
+  sbytes=$(echo "$out" | grep -o "checkpoint stat bytes=[0-9]*" | tail -1 | cut -d= -f2)
+
+  starttime=`date +%s.%N`
+  sst --add-lib-path=$LIB_PATH --load-checkpoint $cpt > /dev/null || echo "RESTART FAILED: $STATS"
+  endtime=`date +%s.%N`
+  restart=$( echo "$endtime - $starttime" | bc -l )
+
+  marginal=0
+  if [ $last_stats -gt 0 ]; then
+    marginal=$( echo "($bytes - $last_bytes) / ($STATS - $last_stats)" | bc -l )
+  fi
+  perstat=$( echo "${sbytes:-0} / $STATS" | bc -l )
+  echo "$STATS $bytes ${sbytes:-0} $perstat $marginal $save $restart" >> $FILE
+
+  last_stats=$STATS
+  last_bytes=$bytes
+  STATS=$(($STATS * 10))
+done
+
+rm -Rf $PFX *.csv
+cat $FILE
+echo "END TEST"
@@ -0,0 +1,76 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# Periodic statistic dump stress test.  Reports, per rank, the bytes written to
+# the statistic output files and the wall clock time spent in output per dump.
+#
+# usage: ./large-stat-dump.sh [ranks] [dumpPeriod] [chkpnt]
+#   ranks      : number of MPI ranks (default 1)
+#   dumpPeriod : cycles between dumps (default 100)
+#   chkpnt     : 1 selects LargeStatChkpnt (default 0)
+
+RANKS=${1:-1}
+PERIOD=${2:-100}
+CHKPNT=${3:-0}
+COMPS=$((RANKS * 10))
+STATS=1000
+CLOCKS=1000
+LIB_PATH="../../build/components/large-stat:../../build/components/large-stat-chkpnt"
+# bench file and the output files it creates
+BENCHES="./large-stat-bench1.py:large-stat-test2*.csv ./large-stat-bench3.py:large-stat-bench3*.h5"
+
+FILE="dump.$RANKS.$PERIOD.$CHKPNT.out"
+
+echo "START TEST: $RANKS ranks, $COMPS components, $STATS stats, dumpPeriod=$PERIOD"
+echo "# bench rank bytes dumps bytesPerDump nsPerDump" > $FILE
+
+if [ $RANKS -gt 1 ]; then
+  MPI="mpirun -np $RANKS"
+fi
+
+# LargeStatChkpnt samples every statistic each tick on its own
+OPTS="--numComps $COMPS --numStats $STATS --numClocks $CLOCKS --dumpPeriod $PERIOD --chkpnt $CHKPNT"
+if [ $CHKPNT -eq 0 ]; then
+  OPTS="$OPTS --sampleMode all"
+fi
+
+for b in $BENCHES
+do
+  bench=${b%%:*}
+  glob=${b#*:}
+  rm -Rf $glob
+  out=$($MPI sst --add-lib-path=$LIB_PATH --model-options="$OPTS" $bench)
+
+  for r in $(seq 0 $((RANKS - 1)))
+  do
+    # single rank output files carry no rank suffix
+    if [ $RANKS -gt 1 ]; then
+      files=$(ls ${glob%\**}*_$r.* 2>/dev/null)
+    else
+      files=$(ls $glob 2>/dev/null)
+    fi
+    bytes=0
+    if [ ! -z "$files" ]; then
+      bytes=$(du -cb $files | tail -1 | cut -f1)
+    fi
+    # sum the per-component dump time for this rank
+    stats=$(echo "$out" | grep -o "rank=$r dumps=[0-9]* dumpNs=[0-9]*" | \
+      awk -F'[= ]' '{d=$4; n+=$6} END {if (d > 0) printf "%d %.3f", d, n/d; else print "0 0"}')
+    dumps=${stats%% *}
+    if [ $dumps -gt 0 ]; then
+      perdump=$((bytes / (dumps + 1)))
+    else
+      perdump=$bytes
+    fi
+    echo "$(basename $bench .py) $r $bytes $dumps $perdump ${stats#* }" >> $FILE
+  done
+  rm -Rf $glob
+done
+
+cat $FILE
+echo "END TEST"
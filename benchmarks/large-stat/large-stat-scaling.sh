@@ -1,4 +1,11 @@
 #!/bin/bash
+#
+# usage: ./large-stat-scaling.sh [register]
+#   register : compare eager, lazy and vector statistic registration time
+#              and RSS at 10^3 to 10^6 statistics per component.  The
+#              compared column is registerNs, which covers the constructor
+#              and setup so that lazy registration is fully counted; the
+#              SST build time alone excludes setup.
 
 COMPS=10
 ENDCOMPS=1000
@@ -9,6 +16,32 @@ MC_LIB_PATH="../../build/components/large-stat"
 TEST1="./large-stat-bench1.py"
 TEST2="./large-stat-bench2.py"
 
+if [ "$1" == "register" ]; then
+  REGSTATS=1000
+  REGENDSTATS=1000000
+  REGFILE="register.$REGSTATS.$REGENDSTATS.out"
+  echo "START REGISTER TEST: $REGSTATS to $REGENDSTATS statistics"
+  echo "# numStats mode registerNs registered build_time max_rss" > $REGFILE
+  while [ $REGSTATS -le $REGENDSTATS ]
+  do
+    for mode in eager lazy vector
+    do
+      echo "...registering $REGSTATS statistics in $mode mode"
+      # round-robin sampling touches 10% of the statistics in lazy mode
+      out=$(sst --print-timing-info --add-lib-path=$MC_LIB_PATH --model-options="--numComps 1 --numStats $REGSTATS --registerMode $mode --numClocks 10 --sampleMode roundrobin --samplesPerTick $(($REGSTATS / 100))" $TEST1)
+      build=$(echo "$out" | grep "Build time" | awk '{print $(NF-1)}')
+      rss=$(echo "$out" | grep "Max Resident Set Size" | awk '{print $(NF-1)$NF}')
+      reg=$(echo "$out" | grep -o "registered=[0-9]* registerNs=[0-9]*" | awk -F'[= ]' '{print $4, $2}')
+      echo "$REGSTATS $mode $reg $build $rss" >> $REGFILE
+      rm -Rf *.csv
+    done
+    REGSTATS=$(($REGSTATS * 10))
+  done
+  cat $REGFILE
+  echo "END REGISTER TEST"
+  exit 0
+fi
+
 echo "START TEST: $COMPS to $ENDCOMPS with interval=$INTERVAL"
 
 FILE="test.$COMPS.$ENDCOMPS.$INTERVAL.out"
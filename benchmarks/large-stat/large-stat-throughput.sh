@@ -0,0 +1,61 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# Measures statistic addData() throughput for each sampling mode, statistic
+# type and output backend (bench1=CSV, bench2=SQLite, bench3=HDF5).  The HDF5
+# backend requires an SST core built with HDF5 support.
+#
+# usage: ./large-stat-throughput.sh [numStats] [numClocks]
+
+STATS=${1:-10000}
+CLOCKS=${2:-1000}
+COMPS=1
+TYPES="accumulator histogram uniquecount"
+SAMPLES="1 10 100 1000"
+MC_LIB_PATH="../../build/components/large-stat"
+BENCHES="./large-stat-bench1.py ./large-stat-bench2.py ./large-stat-bench3.py"
+
+echo "START TEST: $STATS statistics for $CLOCKS clocks"
+
+FILE="throughput.$STATS.$CLOCKS.out"
+
+echo "# bench mode statType samplesPerTick samples nsPerSample runtime_s" > $FILE
+
+run() {
+  local bench=$1
+  local mode=$2
+  local stype=$3
+  local k=$4
+  local starttime=`date +%s.%N`
+  local out=$(sst --add-lib-path=$MC_LIB_PATH --model-options="--numComps $COMPS --numStats $STATS --numClocks $CLOCKS --sampleMode $mode --samplesPerTick $k --statType $stype" $bench)
+  local endtime=`date +%s.%N`
+  local runtime=$( echo "$endtime - $starttime" | bc -l )
+  # sum samples and time across all components
+  local stats=$(echo "$out" | grep -o "samples=[0-9]* sampleNs=[0-9]*" | \
+    awk -F'[= ]' '{s+=$2; n+=$4} END {if (s > 0) printf "%d %.3f", s, n/s; else print "0 0"}')
+  echo "$(basename $bench .py) $mode $stype $k $stats $runtime" >> $FILE 2>&1
+}
+
+for bench in $BENCHES
+do
+  for stype in $TYPES
+  do
+    echo "...running $bench with $stype statistics"
+    run $bench all $stype 1
+    for mode in random roundrobin
+    do
+      for k in $SAMPLES
+      do
+        run $bench $mode $stype $k
+      done
+    done
+    rm -Rf *.csv *.db *.h5
+  done
+done
+
+echo "END TEST"
@@ -0,0 +1,53 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# Measures the per-component clock handler overhead.  For each component count
+# a single-cycle run captures the load cost, which is subtracted from an N cycle
+# run to produce the cost of a single tick in ns.
+#
+# usage: ./clock-scaling-perf.sh [extra model options, e.g. "--workNs 100"]
+
+COMPS=1000
+ENDCOMPS=1000000
+CYCLES=1000
+CLOCKS="1 2 4"
+SUSPEND="0 100"
+MC_LIB_PATH="../../build/components/micro-comp"
+TEST="./micro-comp-clock-bench.py"
+EXTRA="$1"
+
+echo "START TEST: $COMPS to $ENDCOMPS components with $CYCLES cycles"
+
+FILE="clock.$COMPS.$ENDCOMPS.$CYCLES.out"
+
+echo "# comps clocks suspendInterval load_s run_s ns_per_tick" > $FILE
+
+runtime() {
+  local starttime=`date +%s.%N`
+  sst --add-lib-path=$MC_LIB_PATH --model-options="$1" $TEST > /dev/null
+  local endtime=`date +%s.%N`
+  echo "$endtime - $starttime" | bc -l
+}
+
+while [ $COMPS -le $ENDCOMPS ]
+do
+  for c in $CLOCKS
+  do
+    echo "...loading $COMPS components with $c clocks"
+    load=$(runtime "--numComps $COMPS --numClocks $c --numCycles 1 $EXTRA")
+    for s in $SUSPEND
+    do
+      run=$(runtime "--numComps $COMPS --numClocks $c --numCycles $CYCLES --suspendInterval $s $EXTRA")
+      tick=$( echo "($run - $load) * 1000000000 / ($COMPS * $c * $CYCLES)" | bc -l )
+      echo "$COMPS $c $s $load $run $tick" >> $FILE 2>&1
+    done
+  done
+  COMPS=$(($COMPS * 10))
+done
+
+echo "END TEST"
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# micro-comp-bench.py
+#
+#
+
+import sys
+import argparse
+import sst
+
+parser = argparse.ArgumentParser(description="MicroComp Footprint Bench")
+parser.add_argument("--verbose", type=int, help="Verbosity", default=0)
+parser.add_argument("--numComps", type=int, help="Number of components to load", default=1000)
+parser.add_argument("--stateBytes", type=int, help="Bytes of touched state per component", default=0)
+parser.add_argument("--portsPerComp", type=int, help="Number of connected ports per component", default=0)
+parser.add_argument("--statsPerComp", type=int, help="Number of statistics registered per component", default=0)
+parser.add_argument("--enableStats", type=int, help="Enable the registered statistics", default=0)
+args = parser.parse_args()
+
+print("MicroComp Footprint Bench SST Simulation Configuration:")
+for arg in vars(args):
+  print("\t", arg, " = ", getattr(args, arg))
+
+if args.portsPerComp % 2 != 0:
+  print(f"MicroComp-Bench requires an even number of ports per component!")
+  sys.exit(-1)
+
+comps = []
+for i in range(args.numComps):
+  c = sst.Component("c_" + str(i), "microcomp.MicroComp")
+  c.addParams({
+    "verbose" : args.verbose,
+    "stateBytes" : args.stateBytes,
+    "numPorts" : args.portsPerComp,
+    "numStats" : args.statsPerComp
+  })
+  comps.append(c)
+
+# ring: the lower half of the ports of component N connect to the upper half
+# of the ports of component N+1
+half = int(args.portsPerComp / 2)
+for i in range(args.numComps):
+  nxt = (i + 1) % args.numComps
+  for p in range(half):
+    link = sst.Link("link_c" + str(i) + "p" + str(p))
+    link.connect( (comps[i],   "port" + str(p),        "1ns"),
+                  (comps[nxt], "port" + str(p + half), "1ns") )
+
+if args.enableStats != 0:
+  sst.setStatisticLoadLevel(7)
+  sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./micro-comp-bench.csv"})
+  sst.enableAllStatisticsForComponentType("microcomp.MicroComp")
+
+# EOF
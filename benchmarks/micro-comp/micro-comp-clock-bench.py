@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# micro-comp-clock-bench.py
+#
+#
+
+import argparse
+import sst
+
+parser = argparse.ArgumentParser(description="MicroComp Clock Bench")
+parser.add_argument("--verbose", type=int, help="Verbosity", default=0)
+parser.add_argument("--numComps", type=int, help="Number of components to load", default=1)
+parser.add_argument("--numCycles", type=int, help="Number of cycles each clock domain ticks", default=1000)
+parser.add_argument("--numClocks", type=int, help="Number of clock domains per component", default=1)
+parser.add_argument("--workNs", type=int, help="Wall clock ns of spin work per tick", default=0)
+parser.add_argument("--workBytes", type=int, help="Bytes of memory touched per tick", default=0)
+parser.add_argument("--suspendInterval", type=int, help="Ticks between clock suspensions (0 disables)", default=0)
+parser.add_argument("--suspendCycles", type=int, help="Cycles a clock remains suspended", default=10)
+args = parser.parse_args()
+
+print("MicroComp Clock Bench SST Simulation Configuration:")
+for arg in vars(args):
+  print("\t", arg, " = ", getattr(args, arg))
+
+for comp in range(args.numComps):
+  c = sst.Component("c_" + str(comp), "microcomp.MicroComp")
+  c.addParams({
+    "verbose" : args.verbose,
+    "numCycles" : args.numCycles,
+    "numClocks" : args.numClocks,
+    "workNs" : args.workNs,
+    "workBytes" : args.workBytes,
+    "suspendInterval" : args.suspendInterval,
+    "suspendCycles" : args.suspendCycles
+  })
+
+# EOF
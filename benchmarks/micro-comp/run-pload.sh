@@ -0,0 +1,88 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+
+# usage:   ./run-pload.sh [sweep] [sst-sweeper options]
+#   sweep defaults to pload-sanity
+# example: ./run-pload.sh pload_1to8_ranks --numComps=1000000
+
+# Runs BASE_PLOAD sequences: each serial-load (BASE) job writes its
+# configuration which is then loaded with --parallel-load (PLOAD).  The
+# per-component finish reports of each pair must match and the build time
+# speedup of the parallel load is written to micro-comp-pload.csv.
+
+SWEEP=${1:-pload-sanity}
+DB=micro-comp-pload.db
+PATTERN="ticks="
+
+/bin/rm -rf jobs/* $DB micro-comp-pload.sql
+mkdir -p jobs || exit 1
+
+OPTS="--noprompt ${@:2}"
+
+echo "STARTING SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+${SST_BENCH_HOME}/scripts/sst-sweeper.py ./pload-sweeps.json ./micro-comp-bench.py $SWEEP --jobname=$SWEEP ${OPTS}
+echo "COMPLETED SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+# verify that serial and parallel load produced the same components
+rc=0
+pairs=0
+while IFS='|' read -r bid bcwd pid pcwd
+do
+  pairs=$((pairs + 1))
+  bsum=$(grep -h "$PATTERN" $bcwd/log* | sort | md5sum)
+  psum=$(grep -h "$PATTERN" $pcwd/log* | sort | md5sum)
+  bcnt=$(grep -h "$PATTERN" $bcwd/log* | wc -l)
+  pcnt=$(grep -h "$PATTERN" $pcwd/log* | wc -l)
+  if [[ $bcnt -eq 0 ]]; then
+    # nothing to compare: verbose=0 or the base job died before finish
+    echo "MISSING: base job $bid reports no $PATTERN lines"
+    rc=1
+  elif [[ "$bsum" != "$psum" || $bcnt -ne $pcnt ]]; then
+    echo "MISMATCH: base job $bid ($bcnt components) vs pload job $pid ($pcnt components)"
+    rc=1
+  else
+    echo "OK: base job $bid and pload job $pid report $bcnt components"
+  fi
+done < <(sqlite3 $DB "SELECT B.jobid, B.cwd, P.jobid, P.cwd FROM job_info B JOIN job_info P ON P.friend == B.jobid WHERE B.jobtype=='BASE' AND P.jobtype=='PLOAD';")
+if [[ $pairs -eq 0 ]]; then
+  echo "MISSING: no BASE and PLOAD job pairs in $DB"
+  rc=1
+fi
+
+# build time speedup of parallel load over serial load
+cat << EOF > micro-comp-pload.sql
+.headers on
+.mode csv
+
+CREATE TEMP TABLE raw AS
+SELECT
+  J.*, S.*, T.*
+FROM job_info J
+LEFT JOIN
+  sdl_info    S ON S.jobid = J.jobid
+LEFT JOIN
+  timing_info T ON T.jobid = J.jobid;
+
+.output micro-comp-pload.csv
+SELECT
+  B.jobname, B.jobid AS base_jobid, P.jobid AS pload_jobid, B.ranks, B.threads,
+  B.numComps, B.portsPerComp,
+  B.max_build_time AS serial_build_time, P.max_build_time AS parallel_build_time,
+  B.max_build_time / P.max_build_time AS build_speedup,
+  B.global_max_rss AS serial_max_rss, P.global_max_rss AS parallel_max_rss
+FROM raw B
+JOIN raw P ON P.friend == B.jobid
+WHERE B.jobtype == 'BASE' AND P.jobtype == 'PLOAD'
+ORDER BY B.ranks, B.threads;
+
+EOF
+
+sqlite3 $DB < micro-comp-pload.sql
+exit $rc
+
+#EOF
@@ -0,0 +1,80 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+
+# usage:   ./run-sweeps.sh [--slurm] [sst-sweeper options]
+
+# Records build time, RSS and page faults from --timing-info-json into the
+# sweeper database and reports them per component.
+
+# environment variable controls (set enable feature, unset to disable)
+# SWEEP_COMPS
+# SWEEP_FOOTPRINT
+# SWEEP_RANKS
+# example: SWEEP_COMPS=1 ./run-sweeps.sh --numComps=1000000
+
+/bin/rm -rf jobs/* micro-comp.db micro-comp.sql
+mkdir -p jobs || exit 1
+
+OPTS="--noprompt $@"
+
+echo "STARTING SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./micro-comp-bench.py sanity --jobname="sanity" ${OPTS}
+
+if [[ ! -z $SWEEP_COMPS ]]; then
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./micro-comp-bench.py comps_1e5_to_1e6 --jobname="comps" ${OPTS}
+fi
+if [[ ! -z $SWEEP_FOOTPRINT ]]; then
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./micro-comp-bench.py state_0_to_64k --jobname="state" --numComps=100000 ${OPTS}
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./micro-comp-bench.py ports_0_to_16  --jobname="ports" --numComps=100000 ${OPTS}
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./micro-comp-bench.py stats_0_to_64  --jobname="stats" --numComps=100000 ${OPTS}
+fi
+if [[ ! -z $SWEEP_RANKS ]]; then
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./micro-comp-bench.py ranks_1_to_8 --jobname="ranks" --numComps=1000000 ${OPTS}
+fi
+
+echo "COMPLETED SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+# per component footprint and load time
+cat << EOF > micro-comp.sql
+.headers on
+.mode csv
+
+CREATE TEMP TABLE raw AS
+SELECT
+  J.*, S.*, T.*
+FROM job_info J
+LEFT JOIN
+  sdl_info    S ON S.jobid = J.jobid
+LEFT JOIN
+  timing_info T ON T.jobid = J.jobid;
+
+.output raw.csv
+SELECT * FROM raw;
+
+# global_max_rss is reported in kB
+CREATE TEMP TABLE footprint AS
+SELECT
+  jobname, jobid, ranks, threads, sst_version,
+  numComps, stateBytes, portsPerComp, statsPerComp, enableStats,
+  max_build_time, global_max_rss, global_pf,
+  (global_max_rss * 1024.0) / numComps AS bytes_per_comp,
+  max_build_time / numComps AS sec_per_comp,
+  (global_pf * 1.0) / numComps AS pf_per_comp
+FROM
+  raw;
+
+.output micro-comp.csv
+SELECT * FROM footprint ORDER BY jobname, numComps, stateBytes, portsPerComp, statsPerComp, ranks;
+
+EOF
+
+# generate csv files
+sqlite3 micro-comp.db < micro-comp.sql
+
+#EOF
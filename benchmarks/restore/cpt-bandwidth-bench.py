@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# cpt-bandwidth-bench.py
+#
+# Distributes a constant total number of checkpointed bytes (--totalKB)
+# evenly across --numComps restore components so that component count,
+# ranks and threads can be swept without changing the checkpoint size.
+#
+
+import argparse
+import sst
+
+parser = argparse.ArgumentParser(description="Checkpoint Bandwidth Bench")
+parser.add_argument("--verbose", type=int, help="Verbosity", default=0)
+parser.add_argument("--numComps", type=int, help="Number of components to load", default=64)
+parser.add_argument("--totalKB", type=int, help="Total KB of state across all components", default=262144)
+parser.add_argument("--simClocks", type=int, help="Clock cycles to execute", default=10000)
+parser.add_argument("--enableStats", type=int, help="Enable the CPT_ timing statistics", default=1)
+args = parser.parse_args()
+
+print("Checkpoint Bandwidth Bench SST Simulation Configuration:")
+for arg in vars(args):
+  print("\t", arg, " = ", getattr(args, arg))
+
+# per component state in 4 byte increments
+bytesPerComp = int(args.totalKB * 1024 / args.numComps) & ~0x3
+print("\t bytesPerComp  = ", bytesPerComp)
+
+for i in range(args.numComps):
+  c = sst.Component("c_" + str(i), "restore.Restore")
+  c.addParams({
+    "verbose" : args.verbose,
+    "numBytes" : str(bytesPerComp) + "B",
+    "clocks" : args.simClocks,
+    "rngSeed" : 1223 + i
+  })
+
+if args.enableStats != 0:
+  sst.setStatisticLoadLevel(1)
+  sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./cpt-stats.csv"})
+  sst.enableAllStatisticsForComponentType("restore.Restore")
+
+# EOF
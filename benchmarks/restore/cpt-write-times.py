@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# cpt-write-times.py
+#
+# Reports per-checkpoint write cost for the CPT jobs in a sweeper database.
+#
+# For each _cpt/<n>_<timestamp> directory the file count, total bytes and
+# the spread of file modification times are recorded.  The write time of
+# checkpoint n is the interval between the last file written for checkpoint
+# n-1 and the last file written for checkpoint n (the simulated work between
+# checkpoints is negligible for restore components).  The CPT_SER_NS and
+# CPT_SER_BYTES statistics written to cpt-stats*.csv supply the CPU time
+# spent serializing the components, averaged per checkpoint and per thread.
+#
+
+import argparse
+import csv
+import glob
+import os
+import re
+import sqlite3
+import sys
+
+parser = argparse.ArgumentParser(description="Checkpoint write time report")
+parser.add_argument("--db", type=str, default="cpt-bandwidth.db", help="sweeper database [cpt-bandwidth.db]")
+parser.add_argument("--csv", type=str, default="cpt-write-times.csv", help="output csv file [cpt-write-times.csv]")
+args = parser.parse_args()
+
+re_cpt = re.compile(r"^([0-9]+)_([0-9]+)$")
+
+def cpt_dirs(cwd):
+    # returns [(n, timestamp, path)] sorted by checkpoint number
+    dirs = []
+    cptroot = os.path.join(cwd, "_cpt")
+    if not os.path.isdir(cptroot):
+        return dirs
+    for d in os.listdir(cptroot):
+        m = re_cpt.match(d)
+        if m:
+            dirs.append((int(m.group(1)), int(m.group(2)), os.path.join(cptroot, d)))
+    return sorted(dirs)
+
+def ser_stats(cwd):
+    # sum of the CPT_SER_* accumulators over all components and ranks
+    totals = { "CPT_SER_NS" : 0, "CPT_SER_BYTES" : 0 }
+    for f in glob.glob(os.path.join(cwd, "cpt-stats*.csv")):
+        with open(f) as fd:
+            for row in csv.DictReader(fd, skipinitialspace=True):
+                name = row.get("StatisticName", "")
+                if name in totals:
+                    totals[name] += int(row.get("Sum.u64", 0))
+    return totals
+
+con = sqlite3.connect(args.db)
+cur = con.cursor()
+jobs = cur.execute(
+    "SELECT J.jobid, J.jobname, J.cwd, T.ranks, T.threads, S.numComps, S.totalKB "
+    "FROM job_info J "
+    "LEFT JOIN timing_info T ON T.jobid = J.jobid "
+    "LEFT JOIN sdl_info S ON S.jobid = J.jobid "
+    "WHERE J.jobtype == 'CPT' ORDER BY J.jobid").fetchall()
+if len(jobs) == 0:
+    print(f"no CPT jobs found in {args.db}")
+    sys.exit(1)
+
+fields = [ "jobname", "jobid", "ranks", "threads", "numComps", "totalKB",
+           "cpt_num", "cpt_timestamp", "files", "bytes",
+           "mtime_span_sec", "write_sec", "write_mb_per_sec",
+           "ser_sec_per_thread", "ser_bytes", "ser_fraction" ]
+
+with open(args.csv, "w", newline="") as out:
+    w = csv.DictWriter(out, fieldnames=fields)
+    w.writeheader()
+    for jobid, jobname, cwd, ranks, threads, numComps, totalKB in jobs:
+        dirs = cpt_dirs(cwd)
+        if len(dirs) == 0:
+            print(f"job {jobid}: no checkpoints found in {cwd}")
+            continue
+        ranks = int(ranks or 1)
+        threads = int(threads or 1)
+        stats = ser_stats(cwd)
+        serNs = stats["CPT_SER_NS"] / len(dirs)
+        serSec = serNs / 1e9 / (ranks * threads)
+        serBytes = stats["CPT_SER_BYTES"] / len(dirs)
+        prevLast = None
+        for n, timestamp, path in dirs:
+            mtimes = []
+            nbytes = 0
+            for f in os.listdir(path):
+                p = os.path.join(path, f)
+                if os.path.isfile(p):
+                    mtimes.append(os.path.getmtime(p))
+                    nbytes += os.path.getsize(p)
+            if len(mtimes) == 0:
+                continue
+            first = min(mtimes)
+            last = max(mtimes)
+            rec = { "jobname" : jobname, "jobid" : jobid, "ranks" : ranks, "threads" : threads,
+                    "numComps" : numComps, "totalKB" : totalKB,
+                    "cpt_num" : n, "cpt_timestamp" : timestamp,
+                    "files" : len(mtimes), "bytes" : nbytes,
+                    "mtime_span_sec" : f"{last - first:.6f}",
+                    "write_sec" : "", "write_mb_per_sec" : "",
+                    "ser_sec_per_thread" : f"{serSec:.6f}",
+                    "ser_bytes" : int(serBytes), "ser_fraction" : "" }
+            if prevLast is not None and last > prevLast:
+                write = last - prevLast
+                rec["write_sec"] = f"{write:.6f}"
+                rec["write_mb_per_sec"] = f"{nbytes / write / 1e6:.3f}"
+                rec["ser_fraction"] = f"{min(serSec / write, 1.0):.3f}"
+            prevLast = last
+            w.writerow(rec)
+
+con.close()
+print(f"wrote {args.csv}")
+
+# EOF
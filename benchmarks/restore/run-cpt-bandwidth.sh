@@ -0,0 +1,47 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+
+# usage:   ./run-cpt-bandwidth.sh [sst-sweeper options]
+
+# Checkpoints a constant total number of bytes (--totalKB) while sweeping the
+# number of components, ranks and threads.  cpt-write-times.py reports the
+# per-checkpoint write time from the _cpt directory file times and sizes
+# alongside the per-thread serialization time from the CPT_SER_NS statistics.
+# A ser_fraction near 1 indicates checkpoints bound by serialization; near 0
+# indicates checkpoints bound by the file system.
+
+# environment variable controls (set enable feature, unset to disable)
+# SWEEP_COMPS
+# SWEEP_RANKS
+# SWEEP_THREADS
+# example: SWEEP_RANKS=1 SWEEP_THREADS=1 ./run-cpt-bandwidth.sh --totalKB=1048576
+
+/bin/rm -rf jobs/* cpt-bandwidth.db cpt-write-times.csv
+mkdir -p jobs || exit 1
+
+OPTS="--noprompt $@"
+
+echo "STARTING SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+${SST_BENCH_HOME}/scripts/sst-sweeper.py ./cpt-bandwidth.json ./cpt-bandwidth-bench.py sanity --jobname="sanity" ${OPTS}
+
+if [[ ! -z $SWEEP_COMPS ]]; then
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./cpt-bandwidth.json ./cpt-bandwidth-bench.py comps_16_to_256 --jobname="comps" ${OPTS}
+fi
+if [[ ! -z $SWEEP_RANKS ]]; then
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./cpt-bandwidth.json ./cpt-bandwidth-bench.py ranks_1_to_8 --jobname="ranks" ${OPTS}
+fi
+if [[ ! -z $SWEEP_THREADS ]]; then
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./cpt-bandwidth.json ./cpt-bandwidth-bench.py threads_1_to_8 --jobname="threads" ${OPTS}
+fi
+
+echo "COMPLETED SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+./cpt-write-times.py --db cpt-bandwidth.db --csv cpt-write-times.csv
+
+#EOF
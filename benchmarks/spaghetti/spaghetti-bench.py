@@ -23,6 +23,9 @@ parser.add_argument("--portsPerComp", type=int, help="Number of ports per compon
 parser.add_argument("--msgsPerPort", type=int, help="Number of msgs to inject per port", default=100)
 parser.add_argument("--bytesPerMsg", type=int, help="Number of bytes per message", default=64)
 parser.add_argument("--rngSeed", type=int, help="RNG seed value", default=3131)
+parser.add_argument("--reinjectMsgs", type=int, help="Number of msgs re-injected on receipt (0 disables)", default=0)
+parser.add_argument("--stopTimeUs", type=int, help="Closed-loop mode: re-inject on every receipt until this simulated time in us (0 disables)", default=0)
+parser.add_argument("--latencyStats", type=int, help="Write observed latency histograms to spaghetti-latency.csv", default=0)
 args = parser.parse_args()
 
 print("Spaghetti-Bench test SST Simulation Configuration:")
@@ -46,7 +49,9 @@ for comp in range(args.numComps):
         "numPorts" : args.portsPerComp,
         "numMsgs" : args.msgsPerPort,
         "bytesPerMsg" : args.bytesPerMsg,
-        "rngSeed" : args.rngSeed
+        "rngSeed" : args.rngSeed,
+        "reinjectMsgs" : args.reinjectMsgs,
+        "stopTime" : f"{args.stopTimeUs}us" if args.stopTimeUs > 0 else ""
     })
     endpoints.append(c)
 
@@ -70,4 +75,16 @@ for lowerLink in range(0, int(args.portsPerComp/2)):
                   (endpoints[args.numComps-1], "port"+str(upperLink), "1us") )
     upperLink = upperLink - 1
 
+# observed latency histograms per port
+if args.latencyStats != 0:
+    sst.setStatisticLoadLevel(7)
+    sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./spaghetti-latency.csv",
+                                                 "separator" : ", " } )
+    sst.enableStatisticForComponentType("spaghetti.Spaghetti", "RECV_LATENCY_PORT_",
+                                        {"type":"sst.HistogramStatistic",
+                                         "minvalue" : "0",
+                                         "binwidth" : "10000",
+                                         "numbins"  : "50",
+                                         "IncludeOutOfBounds" : "1"})
 
+# EOF
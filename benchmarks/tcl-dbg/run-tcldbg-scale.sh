@@ -0,0 +1,49 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+
+# usage:   ./run-tcldbg-scale.sh [sst-sweeper options]
+
+# Runs thousands of TclDbg components and dumps them from printStatus on a
+# periodic SIGALRM status action (sst_params "sigalrm" in tcldbg-scale.json).
+# Every sweep runs once with a file per component and once with a shared file
+# per rank (--rankFile). tcldbg-dump-report.py reports aggregate dump
+# throughput, the slowest dump and the share of time spent waiting for the
+# shared file so the two layouts can be compared at each scale.
+
+# environment variable controls (set enable feature, unset to disable)
+# SWEEP_COMPS
+# SWEEP_RANKS
+# SWEEP_THREADS
+# example: SWEEP_COMPS=1 ./run-tcldbg-scale.sh --dataWords=65536 --dumpMode=3
+
+/bin/rm -rf jobs/* tcldbg-scale.db tcldbg-dump-report.csv
+mkdir -p jobs || exit 1
+
+OPTS="--noprompt $@"
+
+echo "STARTING SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+for f in 0 1; do
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./tcldbg-scale.json ./tcldbg-scale.py sanity --jobname="sanity_f${f}" --rankFile=${f} ${OPTS}
+
+  if [[ ! -z $SWEEP_COMPS ]]; then
+    ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./tcldbg-scale.json ./tcldbg-scale.py comps_1k_to_8k --jobname="comps_f${f}" --rankFile=${f} ${OPTS}
+  fi
+  if [[ ! -z $SWEEP_RANKS ]]; then
+    ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./tcldbg-scale.json ./tcldbg-scale.py ranks_1_to_8 --jobname="ranks_f${f}" --rankFile=${f} ${OPTS}
+  fi
+  if [[ ! -z $SWEEP_THREADS ]]; then
+    ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./tcldbg-scale.json ./tcldbg-scale.py threads_1_to_8 --jobname="threads_f${f}" --rankFile=${f} ${OPTS}
+  fi
+done
+
+echo "COMPLETED SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+./tcldbg-dump-report.py --db tcldbg-scale.db --csv tcldbg-dump-report.csv
+
+#EOF
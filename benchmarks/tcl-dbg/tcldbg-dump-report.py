@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tcldbg-dump-report.py
+#
+# Reports aggregate dump throughput and contention for the tcldbg-scale
+# jobs in a sweeper database.
+#
+# The statTiming, statBytes and statLockWait accumulators written to
+# dump-stats*.csv are summed over all components and ranks. Every thread
+# dumps its own components back to back, so the dump wall time is
+# approximated by the blocking time per thread and the aggregate throughput
+# is bytes / (blocking time / threads). lock_fraction is the share of the
+# blocking time spent waiting for a shared per-rank dump file and
+# max_block_usec is the slowest single dump, which includes creating and
+# growing the file. files and file_bytes count the tdbg_* and tcldbg-rank*
+# files left in the job directory.
+#
+# Dumps are triggered on wall clock time, so a job that ends before the
+# status interval elapses records too few dumps to measure. The report exits
+# with an error when any job records fewer than --minDumps dumps per
+# component; raise --simClocks for those configurations.
+#
+
+import argparse
+import csv
+import glob
+import os
+import sqlite3
+import sys
+
+parser = argparse.ArgumentParser(description="TclDbg dump throughput report")
+parser.add_argument("--db", type=str, default="tcldbg-scale.db", help="sweeper database [tcldbg-scale.db]")
+parser.add_argument("--csv", type=str, default="tcldbg-dump-report.csv", help="output csv file [tcldbg-dump-report.csv]")
+parser.add_argument("--minDumps", type=int, default=3, help="dumps required per component [3]")
+args = parser.parse_args()
+
+DUMP_MODES = [ "sync", "async", "mmap", "delta" ]
+
+def dump_stats(cwd):
+    # sum, count and max of the dump accumulators over all components and ranks
+    totals = {}
+    for name in [ "statBytes", "statTiming", "statLockWait" ]:
+        totals[name] = { "sum" : 0, "count" : 0, "max" : 0 }
+    for f in glob.glob(os.path.join(cwd, "dump-stats*.csv")):
+        with open(f) as fd:
+            for row in csv.DictReader(fd, skipinitialspace=True):
+                name = row.get("StatisticName", "")
+                if name in totals:
+                    t = totals[name]
+                    t["sum"] += int(row.get("Sum.u64", 0))
+                    t["count"] += int(row.get("Count.u64", 0))
+                    t["max"] = max(t["max"], int(row.get("Max.u64", 0)))
+    return totals
+
+def dump_files(cwd):
+    # (files, bytes) written by the dump modes
+    files = glob.glob(os.path.join(cwd, "tdbg_*")) + glob.glob(os.path.join(cwd, "tcldbg-rank*"))
+    return (len(files), sum(os.path.getsize(f) for f in files if os.path.isfile(f)))
+
+con = sqlite3.connect(args.db)
+cur = con.cursor()
+jobs = cur.execute(
+    "SELECT J.jobid, J.jobname, J.cwd, T.ranks, T.threads, T.max_run_time, "
+    "S.numComps, S.dataWords, S.updateWords, S.dumpMode, S.rankFile "
+    "FROM job_info J "
+    "LEFT JOIN timing_info T ON T.jobid = J.jobid "
+    "LEFT JOIN sdl_info S ON S.jobid = J.jobid "
+    "WHERE J.jobtype == 'BASE' ORDER BY J.jobid").fetchall()
+if len(jobs) == 0:
+    print(f"no BASE jobs found in {args.db}")
+    sys.exit(1)
+
+fields = [ "jobname", "jobid", "ranks", "threads", "numComps", "dataWords", "updateWords",
+           "dumpMode", "rankFile", "run_sec", "dumps", "bytes", "files", "file_bytes",
+           "block_sec", "block_sec_per_thread", "max_block_usec", "agg_mb_per_sec",
+           "lock_fraction" ]
+
+short = 0
+with open(args.csv, "w", newline="") as out:
+    w = csv.DictWriter(out, fieldnames=fields)
+    w.writeheader()
+    for jobid, jobname, cwd, ranks, threads, runSec, numComps, dataWords, updateWords, dumpMode, rankFile in jobs:
+        ranks = int(ranks or 1)
+        threads = int(threads or 1)
+        stats = dump_stats(cwd)
+        dumps = stats["statTiming"]["count"]
+        if dumps < args.minDumps * int(numComps or 1):
+            print(f"error: job {jobid} recorded {dumps} dumps for {numComps} components in {cwd}; "
+                  f"{args.minDumps} per component are required")
+            short += 1
+            if dumps == 0:
+                continue
+        files, fileBytes = dump_files(cwd)
+        blockSec = stats["statTiming"]["sum"] / 1e6
+        blockPerThread = blockSec / (ranks * threads)
+        mode = int(dumpMode or 0)
+        rec = { "jobname" : jobname, "jobid" : jobid, "ranks" : ranks, "threads" : threads,
+                "numComps" : numComps, "dataWords" : dataWords, "updateWords" : updateWords,
+                "dumpMode" : DUMP_MODES[mode] if 0 <= mode < len(DUMP_MODES) else mode,
+                "rankFile" : rankFile, "run_sec" : runSec,
+                "dumps" : dumps, "bytes" : stats["statBytes"]["sum"],
+                "files" : files, "file_bytes" : fileBytes,
+                "block_sec" : f"{blockSec:.6f}",
+                "block_sec_per_thread" : f"{blockPerThread:.6f}",
+                "max_block_usec" : stats["statTiming"]["max"],
+                "agg_mb_per_sec" : "", "lock_fraction" : "" }
+        if blockPerThread > 0:
+            rec["agg_mb_per_sec"] = f"{stats['statBytes']['sum'] / blockPerThread / 1e6:.3f}"
+        if blockSec > 0:
+            lockSec = stats["statLockWait"]["sum"] / 1e9
+            rec["lock_fraction"] = f"{min(lockSec / blockSec, 1.0):.3f}"
+        w.writerow(rec)
+
+con.close()
+print(f"wrote {args.csv}")
+if short > 0:
+    print(f"error: {short} jobs recorded too few dumps")
+    sys.exit(1)
+
+# EOF
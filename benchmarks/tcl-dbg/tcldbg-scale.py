@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tcldbg-scale.py
+#
+# Loads --numComps independent TclDbg components, each holding --dataWords
+# 32 bit values of which --updateWords are rewritten every --clockDelay
+# cycles. Dumps are taken by printStatus, so the run must be driven by a
+# signal or the interactive console, e.g.
+#   sst --sigalrm="sst.rt.status.all(interval=1s)" tcldbg-scale.py
+#   kill -USR2 <sst pid>
+#
+# --dumpMode : 0=sync 1=async 2=mmap 3=delta
+# --rankFile : 0 writes ./tdbg_<n>.tdbg per component (mmap/delta)
+#              1 writes one shared ./tcldbg-rank<r>.tdbg per rank
+#
+
+import argparse
+import sst
+
+DUMP_MODES = [ "sync", "async", "mmap", "delta" ]
+
+parser = argparse.ArgumentParser(description="TclDbg Scalable Dump Bench")
+parser.add_argument("--verbose", type=int, help="Verbosity", default=0)
+parser.add_argument("--numComps", type=int, help="Number of components to load", default=1024)
+parser.add_argument("--dataWords", type=int, help="32 bit state values per component", default=16384)
+parser.add_argument("--updateWords", type=int, help="Values rewritten per update; 0 regenerates all", default=64)
+parser.add_argument("--clockDelay", type=int, help="Clock cycles between updates", default=100)
+parser.add_argument("--simClocks", type=int, help="Clock cycles to execute", default=2000000)
+parser.add_argument("--dumpMode", type=int, help="0=sync 1=async 2=mmap 3=delta", default=2)
+parser.add_argument("--rankFile", type=int, help="Dump mmap/delta records to one file per rank", default=0)
+parser.add_argument("--keyframeInterval", type=int, help="Dumps between keyframes (delta)", default=16)
+parser.add_argument("--enableStats", type=int, help="Enable the dump statistics", default=1)
+args = parser.parse_args()
+
+print("TclDbg Scalable Dump Bench SST Simulation Configuration:")
+for arg in vars(args):
+  print("\t", arg, " = ", getattr(args, arg))
+
+if args.dumpMode < 0 or args.dumpMode >= len(DUMP_MODES):
+  print(f"error: dumpMode must be 0 to {len(DUMP_MODES) - 1}")
+  exit(1)
+
+for i in range(args.numComps):
+  c = sst.Component("tdbg_" + str(i), "tcldbg.TclDbg")
+  c.addParams({
+    "verbose" : args.verbose,
+    "minData" : args.dataWords,
+    "maxData" : args.dataWords,
+    "updateWords" : args.updateWords,
+    "clockDelay" : args.clockDelay,
+    "clocks" : args.simClocks,
+    "rngSeed" : 1223 + i,
+    "clockFreq" : "1Ghz",
+    "dumpMode" : DUMP_MODES[args.dumpMode],
+    "dumpFile" : "rank" if args.rankFile != 0 else "component",
+    "keyframeInterval" : args.keyframeInterval
+  })
+
+if args.enableStats != 0:
+  sst.setStatisticLoadLevel(1)
+  sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./dump-stats.csv"})
+  sst.enableAllStatisticsForComponentType("tcldbg.TclDbg")
+
+# EOF
@@ -0,0 +1,66 @@
+#!/bin/bash
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+
+# usage:   ./run-sweeps.sh [--slurm] [sst-sweeper options]
+
+# Runs the depth and distribution sweeps once per TimeVortex implementation
+# environment variable controls (set enable feature, unset to disable)
+# SWEEP_STRONG
+# TV_IMPLS       space separated list of TimeVortex implementations
+# example: TV_IMPLS="sst.timevortex.priority_queue" ./run-sweeps.sh --norun
+
+/bin/rm -rf jobs/* tv-stress.db tv-stress.csv tv-stress.sql
+mkdir -p jobs || exit 1
+
+OPTS="--noprompt $1"
+
+if [[ -z $TV_IMPLS ]]; then
+  TV_IMPLS="sst.timevortex.priority_queue"
+fi
+
+echo "STARTING SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+for tv in ${TV_IMPLS}
+do
+  tag=$(echo $tv | sed 's/.*\.//')
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./tv-stress-bench.py depth_16to1024 --timeVortex=$tv --jobname="depth_${tag}" ${OPTS}
+  ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./tv-stress-bench.py dist_all       --timeVortex=$tv --jobname="dist_${tag}"  ${OPTS}
+  if [[ ! -z $SWEEP_STRONG ]]; then
+    ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./tv-stress-bench.py strong_scaling_1to12_threads --timeVortex=$tv --jobname="ss1t_${tag}" ${OPTS}
+    ${SST_BENCH_HOME}/scripts/sst-sweeper.py ./perf-sweeps.json ./tv-stress-bench.py strong_scaling_1to12_ranks   --timeVortex=$tv --jobname="ss1r_${tag}" ${OPTS}
+  fi
+done
+
+echo "COMPLETED SWEEPS AT: $(date +%y%m%d-%H:%M:%S)"
+
+# simple sql script to extract some good info
+cat << EOF > tv-stress.sql
+.headers on
+.mode csv
+
+CREATE TEMP TABLE raw AS
+SELECT
+  J.*, S.*, T.*
+FROM job_info J
+LEFT JOIN
+  sdl_info    S ON S.jobid = J.jobid
+LEFT JOIN
+  timing_info T ON T.jobid = J.jobid;
+
+.output tv-stress.csv
+SELECT
+  jobname, jobid, ranks, threads, numComps, depth, delayDist,
+  global_max_tv_depth, max_build_time, max_run_time, max_total_time, simulated_time_ua
+FROM raw;
+
+EOF
+
+# generate csv files
+sqlite3 tv-stress.db < tv-stress.sql
+
+#EOF
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tv-stress-bench.py
+#
+#
+
+import sys
+import os
+import argparse
+import sst
+
+parser = argparse.ArgumentParser(description="TimeVortex Stress Bench")
+parser.add_argument("--verbose", type=int, help="Verbosity", default=0)
+parser.add_argument("--numComps", type=int, help="Number of TvStress components", default=2)
+parser.add_argument("--portsPerComp", type=int, help="Number of ring ports per component (0 or 2)", default=0)
+parser.add_argument("--depth", type=int, help="Number of in-flight events per component", default=16)
+parser.add_argument("--delayDist", type=int, help="Delay distribution: 0=uniform 1=exponential 2=pareto 3=constant", default=0)
+parser.add_argument("--minDelay", type=int, help="Minimum delay in timeBase units", default=1)
+parser.add_argument("--maxDelay", type=int, help="Maximum delay in timeBase units", default=1000)
+parser.add_argument("--meanDelay", type=int, help="Mean (exponential) or fixed (constant) delay", default=100)
+parser.add_argument("--paretoShapeX10", type=int, help="Pareto shape parameter x10 (sst-sweeper overrides are integers)", default=15)
+parser.add_argument("--stopTimeUs", type=int, help="Simulated stop time in us", default=1000)
+parser.add_argument("--rngSeed", type=int, help="RNG seed value", default=3131)
+parser.add_argument("--rateStats", type=int, help="Write event rate statistics to tv-stress.csv", default=0)
+args = parser.parse_args()
+
+print("TvStress-Bench test SST Simulation Configuration:")
+for arg in vars(args):
+    print("\t", arg, " = ", getattr(args, arg))
+
+dists = ["uniform", "exponential", "pareto", "constant"]
+if args.delayDist < 0 or args.delayDist >= len(dists):
+    print(f"TvStress-Bench delayDist must be in [0,{len(dists)-1}]!")
+    sys.exit(-1)
+
+if args.portsPerComp != 0 and args.portsPerComp != 2:
+    print(f"TvStress-Bench supports 0 or 2 ports per component!")
+    sys.exit(-1)
+
+# create all the components
+endpoints = []
+for comp in range(args.numComps):
+    c = sst.Component("tv"+str(comp), "tvstress.TvStress")
+    c.addParams({
+        "verbose": args.verbose,
+        "numPorts" : args.portsPerComp,
+        "depth" : args.depth,
+        "delayDist" : dists[args.delayDist],
+        "minDelay" : args.minDelay,
+        "maxDelay" : args.maxDelay,
+        "meanDelay" : args.meanDelay,
+        "paretoShape" : args.paretoShapeX10 / 10.0,
+        "stopTime" : f"{args.stopTimeUs}us",
+        "rngSeed" : args.rngSeed
+    })
+    endpoints.append(c)
+
+# optional ring network: port0 of component N connects to port1 of N+1
+if args.portsPerComp == 2:
+    for comp in range(args.numComps):
+        link = sst.Link("link_s" + str(comp))
+        link.connect( (endpoints[comp], "port0", "1ns"),
+                      (endpoints[(comp+1) % args.numComps], "port1", "1ns") )
+
+if args.rateStats != 0:
+    sst.setStatisticLoadLevel(1)
+    sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./tv-stress.csv",
+                                                 "separator" : ", " } )
+    sst.enableStatisticForComponentType("tvstress.TvStress", "EVENTS")
+    sst.enableStatisticForComponentType("tvstress.TvStress", "EVENT_RATE")
+
+# EOF
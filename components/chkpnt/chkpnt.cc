@@ -44,27 +44,46 @@ Chkpnt::Chkpnt(SST::ComponentId_t id, const SST::Params& params ) :
                  getName().c_str());
   }
 
-  // setup the rng
-  mersenne = new SST::RNG::MersenneRNG(params.find<unsigned int>("rngSeed", 1223));
-
-  // setup the links
+  // setup the links and their payload generators; the receiving port of
+  // the adjacent component uses the same seed to check the payloads
+  const unsigned rngSeed = params.find<unsigned int>("rngSeed", 1223);
   for( unsigned i=0; i<numPorts; i++ ){
     linkHandlers.push_back(configureLink("port"+std::to_string(i),
-                                         new Event::Handler2<Chkpnt,
-                                         &Chkpnt::handleEvent>(this)));
+                                         new SST_EVENT_HANDLER<Chkpnt,
+                                         &Chkpnt::handleEvent,
+                                         unsigned>(this, i)));
+    sendRNG.push_back(new SST::RNG::MersenneRNG(rngSeed + i));
+    recvRNG.push_back(new SST::RNG::MersenneRNG(rngSeed + i));
   }
 
+  // checkpoint timing statistics
+  cptStats.registerStats(registerStatistic<uint64_t>("CPT_SER_NS"),
+                         registerStatistic<uint64_t>("CPT_SER_BYTES"),
+                         registerStatistic<uint64_t>("CPT_DESER_NS"),
+                         registerStatistic<uint64_t>("CPT_DESER_BYTES"));
+  runDigest.registerStat(registerStatistic<uint64_t>("RUN_DIGEST"));
+
   // constructor complete
   output.verbose( CALL_INFO, 5, 0, "Constructor complete\n" );
 }
 
 Chkpnt::~Chkpnt(){
+  for( auto* r : sendRNG )
+    delete r;
+  for( auto* r : recvRNG )
+    delete r;
 }
 
 void Chkpnt::setup(){
 }
 
 void Chkpnt::finish(){
+  cptStats.flush();
+  cptStats.report(output, getRank().rank);
+  SCOPEPROF_REPORT(output);
+  output.verbose(CALL_INFO, 1, 0, "%s %s\n",
+                 getName().c_str(), runDigest.str().c_str());
+  runDigest.report(output, getRank().rank);
 }
 
 void Chkpnt::init( unsigned int phase ){
@@ -74,7 +93,9 @@ void Chkpnt::printStatus( Output& out ){
 }
 
 void Chkpnt::serialize_order(SST::Core::Serialization::serializer& ser){
+  cptStats.begin(ser);
   SST::Component::serialize_order(ser);
+  SST_SER(output);
   SST_SER(clockHandler);
   SST_SER(numPorts);
   SST_SER(minData);
@@ -82,30 +103,56 @@ void Chkpnt::serialize_order(SST::Core::Serialization::serializer& ser){
   SST_SER(clockDelay);
   SST_SER(clocks);
   SST_SER(curCycle);
-  SST_SER(mersenne);
+  SST_SER(sendRNG);
+  SST_SER(recvRNG);
   SST_SER(linkHandlers);
+  runDigest.serialize_order(ser);
+  cptStats.serialize_order(ser);
+  cptStats.end(ser);
 }
 
-void Chkpnt::handleEvent(SST::Event *ev){
+void Chkpnt::handleEvent(SST::Event *ev, unsigned port){
+  SCOPEPROF("Chkpnt::handleEvent");
   ChkpntEvent *cev = static_cast<ChkpntEvent*>(ev);
+  const std::vector<unsigned> data = cev->getData();
   output.verbose(CALL_INFO, 5, 0,
-                 "%s: received %zu unsigned values\n",
+                 "%s: received %zu unsigned values on link %u\n",
                  getName().c_str(),
-                 cev->getData().size());
+                 data.size(), port);
+
+  // regenerate the payload the adjacent component sent on this link
+  uint64_t range = maxData - minData + 1;
+  uint64_t r = (uint64_t)(recvRNG[port]->generateNextUInt32()) % range + minData;
+  if( r != data.size() ){
+    output.fatal(CALL_INFO, -1,
+                 "%s: link %u expected %" PRIu64 " values but received %zu\n",
+                 getName().c_str(), port, r, data.size());
+  }
+  for( uint64_t i=0; i<r; i++ ){
+    unsigned d = (unsigned)(recvRNG[port]->generateNextUInt32());
+    if( d != data[i] ){
+      output.fatal(CALL_INFO, -1,
+                   "%s: link %u value %" PRIu64 " expected 0x%x but received 0x%x\n",
+                   getName().c_str(), port, i, d, data[i]);
+    }
+  }
+  runDigest.add(getCurrentSimCycle(), port, data);
   delete ev;
 }
 
 void Chkpnt::sendData(){
+  SCOPEPROF("Chkpnt::sendData");
   for( unsigned i=0; i<numPorts; i++ ){
     // generate a new payload
     std::vector<unsigned> data;
     uint64_t range = maxData - minData + 1;
-    uint64_t r = (uint64_t)rand() % range + minData;
-    for( unsigned i=0; i<r; i++ ){
-      data.push_back((unsigned)(mersenne->generateNextUInt32()));
+    uint64_t r = (uint64_t)(sendRNG[i]->generateNextUInt32()) % range + minData;
+    for( uint64_t j=0; j<r; j++ ){
+      data.push_back((unsigned)(sendRNG[i]->generateNextUInt32()));
     }
+    runDigest.add(getCurrentSimCycle(), numPorts + i, data);
     output.verbose(CALL_INFO, 5, 0,
-                   "%s: sending %zu unsigned values on link %d\n",
+                   "%s: sending %zu unsigned values on link %u\n",
                    getName().c_str(),
                    data.size(), i);
     ChkpntEvent *ev = new ChkpntEvent(data);
@@ -114,6 +161,9 @@ void Chkpnt::sendData(){
 }
 
 bool Chkpnt::clockTick( SST::Cycle_t currentCycle ){
+  SCOPEPROF("Chkpnt::clockTick");
+  // record the deserialize sample on the first tick after a restart
+  cptStats.flush();
 
   // check to see whether we need to send data over the links
   curCycle++;
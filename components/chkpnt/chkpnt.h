@@ -23,6 +23,9 @@
 
 // -- SST Headers
 #include "SST.h"
+#include "cptstats.h"
+#include "rundigest.h"
+#include "scopeprof.h"
 // clang-format on
 
 namespace SST::Chkpnt{
@@ -124,7 +127,10 @@ public:
   // -------------------------------------------------------
   // Chkpnt Component Statistics Data
   // -------------------------------------------------------
-  SST_ELI_DOCUMENT_STATISTICS()
+  SST_ELI_DOCUMENT_STATISTICS(
+    CPTSTATS_ELI_STATISTICS,
+    RUNDIGEST_ELI_STATISTICS
+  )
 
   // -------------------------------------------------------
   // Chkpnt Component Checkpoint Methods
@@ -143,6 +149,7 @@ private:
   SST::Output    output;                          ///< SST output handler
   TimeConverter timeConverter ;                   ///< SST time conversion handler
   SST::Clock::HandlerBase* clockHandler;          ///< Clock Handler
+  cptstats::CptStats cptStats;                    ///< checkpoint timing statistics
 
   // -- parameters
   unsigned numPorts;                              ///< number of ports to configure
@@ -153,13 +160,18 @@ private:
   uint64_t curCycle;                              ///< current cycle delay
 
   // -- rng objects
-  SST::RNG::Random* mersenne;                     ///< mersenne twister object
+  // port N of both components of a link seed their streams with rngSeed+N
+  std::vector<SST::RNG::Random*> sendRNG;         ///< per port payload generators
+  std::vector<SST::RNG::Random*> recvRNG;         ///< per port payload checkers
 
   std::vector<SST::Link *> linkHandlers;          ///< LinkHandler objects
 
+  // -- traffic digest; sends on port N are recorded as port numPorts+N
+  rundigest::RunDigest runDigest;                 ///< digest of all sent and received payloads
+
   // -- private methods
   /// event handler
-  void handleEvent(SST::Event *ev);
+  void handleEvent(SST::Event *ev, unsigned port);
 
   /// sends data to adjacent links
   void sendData();
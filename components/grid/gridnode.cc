@@ -104,6 +104,12 @@ GridNode::GridNode(SST::ComponentId_t id, const SST::Params& params ) :
   localRNG = new SST::RNG::MersenneRNG(unsigned(id) + rngSeed);
   clkDelay = localRNG->generateNextUInt32() % (maxDelay-minDelay+1) + minDelay;
 
+  // checkpoint timing statistics
+  cptStats.registerStats(registerStatistic<uint64_t>("CPT_SER_NS"),
+                         registerStatistic<uint64_t>("CPT_SER_BYTES"),
+                         registerStatistic<uint64_t>("CPT_DESER_NS"),
+                         registerStatistic<uint64_t>("CPT_DESER_BYTES"));
+
   // constructor complete
   output.verbose( CALL_INFO, 5, 0, "Constructor complete\n" );
 }
@@ -120,6 +126,9 @@ void GridNode::setup(){
 }
 
 void GridNode::finish(){
+  cptStats.flush();
+  cptStats.report(output, getRank().rank);
+  SCOPEPROF_REPORT(output);
 }
 
 void GridNode::init( unsigned int phase ){
@@ -138,6 +147,7 @@ void GridNode::printStatus( Output& out ){
 }
 
 void GridNode::serialize_order(SST::Core::Serialization::serializer& ser){
+  cptStats.begin(ser);
   SST::Component::serialize_order(ser);
   SST_SER(cptBegin);
   SST_SER(clockHandler);
@@ -161,10 +171,13 @@ void GridNode::serialize_order(SST::Core::Serialization::serializer& ser){
   SST_SER(demoBug);
   SST_SER(dataMask);
   SST_SER(dataMax);
+  cptStats.serialize_order(ser);
   SST_SER(cptEnd);
+  cptStats.end(ser);
 }
 
 void GridNode::handleEvent(SST::Event *ev){
+  SCOPEPROF("GridNode::handleEvent");
   GridNodeEvent *cev = static_cast<GridNodeEvent*>(ev);
   auto data = cev->getData();
   output.verbose(CALL_INFO, 5, 0,
@@ -207,6 +220,7 @@ void GridNode::handleEvent(SST::Event *ev){
 }
 
 void GridNode::sendData(){
+  SCOPEPROF("GridNode::sendData");
   // Iterate over sending ports.
   // Treating links as unidirectional so the recieve port RNG tracks the send port.
   // TODO: create 2 RNG's per port, one for send, one for recieve
@@ -266,6 +280,10 @@ unsigned GridNode::neighbor(unsigned n)
 }
 
 bool GridNode::clockTick( SST::Cycle_t currentCycle ){
+  SCOPEPROF("GridNode::clockTick");
+  // record the deserialize sample on the first tick after a restart
+  cptStats.flush();
+
   // sanity check the array
   assert(state.size() == numBytes/4ull);
   uint64_t i=0;
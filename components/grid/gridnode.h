@@ -24,6 +24,8 @@
 // clang-format off
 // -- SST Headers
 #include "SST.h"
+#include "cptstats.h"
+#include "scopeprof.h"
 #include <sst/core/rng/distrib.h>
 #include <sst/core/rng/rng.h>
 #include <sst/core/rng/mersenne.h>
@@ -457,7 +459,9 @@ public:
   // -------------------------------------------------------
   // GridNode Component Statistics Data
   // -------------------------------------------------------
-  SST_ELI_DOCUMENT_STATISTICS()
+  SST_ELI_DOCUMENT_STATISTICS(
+    CPTSTATS_ELI_STATISTICS
+  )
 
   // -------------------------------------------------------
   // GridNode Component Checkpoint Methods
@@ -476,6 +480,7 @@ private:
   SST::Output    output;                          ///< SST output handler
   TimeConverter timeConverter;                    ///< SST time conversion handler
   SST::Clock::HandlerBase* clockHandler;          ///< Clock Handler
+  cptstats::CptStats cptStats;                    ///< checkpoint timing statistics
 
   // -- parameters
   uint64_t numBytes;                              ///< number of bytes of internal state
@@ -1,6 +1,76 @@
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include "Node.h"
 
+ComponentBuffer::~ComponentBuffer()
+{
+    free(data);
+}
+
+void ComponentBuffer::fill(size_t bytes, double touchFraction, uint64_t seed)
+{
+    free(data);
+    size = bytes;
+    touchedPages = 0;
+    // calloc keeps untouched pages unbacked (read as zero)
+    data = (size == 0) ? nullptr : (uint8_t*)calloc(size, sizeof(uint8_t));
+
+    size_t numPages = (size + pageBytes - 1) / pageBytes;
+    for (size_t p = 0; p < numPages; p++) {
+        // Touch evenly spaced pages so the footprint scales with the fraction
+        auto lo = (uint64_t)((double)p * touchFraction);
+        auto hi = (uint64_t)((double)(p + 1) * touchFraction);
+        if (hi == lo) {
+            continue;
+        }
+        size_t end = std::min(size, (p + 1) * pageBytes);
+        for (size_t i = p * pageBytes; i < end; i++) {
+            data[i] = (uint8_t)(((seed ^ i) * 0x9E3779B97F4A7C15ULL) >> 56);
+        }
+        touchedPages++;
+    }
+    checksum = computeChecksum();
+}
+
+uint64_t ComponentBuffer::computeChecksum() const
+{
+    // FNV-1a over 8 byte words followed by the tail bytes
+    uint64_t h = 0xcbf29ce484222325ULL ^ size;
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++) {
+        uint64_t w;
+        memcpy(&w, data + i * sizeof(uint64_t), sizeof(uint64_t));
+        h = (h ^ w) * 0x100000001b3ULL;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++) {
+        h = (h ^ (uint64_t)data[i]) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+void ComponentBuffer::serialize_order(SST::Core::Serialization::serializer& ser)
+{
+    SST_SER(size);
+    SST_SER(touchedPages);
+    SST_SER(checksum);
+    switch (ser.mode()) {
+    case SST::Core::Serialization::serializer::UNPACK:
+        free(data);
+        data = (size == 0) ? nullptr : (uint8_t*)malloc(size);
+        [[fallthrough]];
+    case SST::Core::Serialization::serializer::SIZER:
+    case SST::Core::Serialization::serializer::PACK:
+        if (size != 0) {
+            ser.raw(data, size);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
 Node::Node(SST::ComponentId_t id, SST::Params& params)
     : SST::Component(id)
 {
@@ -17,6 +87,8 @@ Node::Node(SST::ComponentId_t id, SST::Params& params)
     largePayload = params.find<int>("largePayload", -1);
     largeEventFraction = params.find<double>("largeEventFraction", -1.0);
     verbose = params.find<int>("verbose", 0);
+    output.init("Node[" + getName() + ":@p:@t]: ", (uint32_t)verbose, 0,
+                SST::Output::STDOUT);
 
     if (myCol == -1) {
         std::cerr << "WARNING: Failed to get myCol\n";
@@ -44,12 +116,17 @@ Node::Node(SST::ComponentId_t id, SST::Params& params)
     timeToRun = params.find<std::string>("timeToRun");
     eventDensity = params.find<double>("eventDensity");
 
-    unsigned componentSize = params.find<unsigned>("componentSize", 0);
-    if (componentSize == 0) {
-        additionalData = nullptr;
-    } else {
-        additionalData = (char*)malloc(componentSize * sizeof(char));
+    size_t componentSize = params.find<size_t>("componentSize", 0);
+    double componentTouchFraction =
+        params.find<double>("componentTouchFraction", 1.0);
+    if (componentTouchFraction < 0.0 || componentTouchFraction > 1.0) {
+        std::cerr << "WARNING: componentTouchFraction outside [0,1], "
+                     "clamping\n";
+        componentTouchFraction =
+            std::min(1.0, std::max(0.0, componentTouchFraction));
     }
+    additionalData.fill(componentSize, componentTouchFraction,
+                        (uint64_t)myId);
 
     recvCount = 0;
     numLinks = (2 * numRings + 1) * (2 * numRings + 1);
@@ -61,6 +138,12 @@ Node::Node(SST::ComponentId_t id, SST::Params& params)
 
     setupLinks<Node>();
 
+    runDigest.registerStat(registerStatistic<uint64_t>("RUN_DIGEST"));
+    perfStats.registerStats(registerStatistic<uint64_t>("PERF_CYCLES"),
+                            registerStatistic<uint64_t>("PERF_INSTRUCTIONS"),
+                            registerStatistic<uint64_t>("PERF_CACHE_MISSES"),
+                            registerStatistic<uint64_t>("PERF_BRANCH_MISSES"));
+
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
     auto* clkHandler =
@@ -73,9 +156,6 @@ Node::Node(SST::ComponentId_t id, SST::Params& params)
 Node::~Node()
 {
     delete rng;
-    if (additionalData != nullptr) {
-        free(additionalData);
-    }
 #ifdef ENABLE_SSTDBG
     delete dbg;
 #endif
@@ -83,6 +163,8 @@ Node::~Node()
 
 void Node::setup()
 {
+    perfStats.start();
+
     double counter = eventDensity;
 
     while (counter >= 1.0) {
@@ -115,9 +197,21 @@ void Node::finish()
     std::string msg = std::to_string(myRow) + "," +
                       std::to_string(myCol) + ":" +
                       std::to_string(recvCount) + "\n";
+    if (verbose && additionalData.getSize() != 0) {
+        std::cerr << myRow << "," << myCol << ": componentSize "
+                  << additionalData.getSize() << " bytes, "
+                  << additionalData.getTouchedPages() << " pages touched, "
+                  << (additionalData.verify() ? "checksum ok" :
+                                                "CHECKSUM MISMATCH")
+                  << "\n";
+    }
     if (verbose) {
         std::cerr << msg;
     }
+    output.verbose(CALL_INFO, 1, 0, "%s %s\n", getName().c_str(),
+                   runDigest.str().c_str());
+    runDigest.report(output, getRank().rank);
+    perfStats.stop(getSimulationOutput());
 }
 
 bool Node::tick(SST::Cycle_t /* currentCycle */)
@@ -139,11 +233,13 @@ SST::Interfaces::StringEvent* Node::createEvent()
     return ev;
 }
 
-void Node::handleEvent(SST::Event* ev)
+void Node::handleEvent(SST::Event* ev, size_t port)
 {
     SST::Interfaces::StringEvent* payloadEv =
         dynamic_cast<SST::Interfaces::StringEvent*>(ev);
-    (void)payloadEv; // explicit unused marker
+    if (payloadEv) {
+        runDigest.add(getCurrentSimTime(), port, payloadEv->getString());
+    }
     delete ev;
 
     static auto ps = getTimeConverter("1ps");
@@ -222,6 +318,7 @@ void Node::serialize_order(SST::Core::Serialization::serializer& ser)
     SST_SER(myRow);
     SST_SER(myCol);
     SST_SER(verbose);
+    SST_SER(output);
     SST_SER(numRings);
     SST_SER(links);
     SST_SER(numLinks);
@@ -232,8 +329,19 @@ void Node::serialize_order(SST::Core::Serialization::serializer& ser)
     SST_SER(smallPayload);
     SST_SER(largePayload);
     SST_SER(largeEventFraction);
-    SST_SER(additionalData);
+    additionalData.serialize_order(ser);
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK &&
+        !additionalData.verify()) {
+        getSimulationOutput().fatal(CALL_INFO, -1,
+            "%s: restored componentSize buffer failed checksum "
+            "(%zu bytes, expected 0x%" PRIx64 ", found 0x%" PRIx64 ")\n",
+            getName().c_str(), additionalData.getSize(),
+            additionalData.getChecksum(),
+            additionalData.computeChecksum());
+    }
     SST_SER(recvCount);
+    runDigest.serialize_order(ser);
+    perfStats.serialize_order(ser);
 
     // SST RNG has built-in serialization support
     SST_SER(rng);
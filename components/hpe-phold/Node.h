@@ -7,6 +7,8 @@
 #define _pholdNode_H
 
 #include "SST.h"
+#include "rundigest.h"
+#include "perfstats.h"
 
 #ifdef ENABLE_SSTDBG
 #include <sst/dbg/SSTDebug.h>
@@ -14,6 +16,40 @@
 
 #define ENABLE_SSTCHECKPOINT
 
+// Sized, pattern-filled buffer used to model additional component state.
+// The length and a checksum of the contents are carried through
+// checkpoints so the restored bytes can be verified after a restart.
+// In sparse mode only a fraction of the pages are written; untouched
+// pages stay unbacked until restore.
+class ComponentBuffer {
+public:
+    static constexpr size_t pageBytes = 4096;
+
+    ComponentBuffer() : data(nullptr), size(0), touchedPages(0), checksum(0) {}
+    ~ComponentBuffer();
+    ComponentBuffer(const ComponentBuffer&) = delete;
+    ComponentBuffer& operator=(const ComponentBuffer&) = delete;
+
+    // Allocate `bytes` and pattern fill `touchFraction` of its pages
+    void fill(size_t bytes, double touchFraction, uint64_t seed);
+
+    // Recompute the checksum and compare against the recorded value
+    bool verify() const { return computeChecksum() == checksum; }
+
+    uint64_t computeChecksum() const;
+    uint64_t getChecksum() const { return checksum; }
+    size_t getSize() const { return size; }
+    size_t getTouchedPages() const { return touchedPages; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser);
+
+private:
+    uint8_t* data;
+    size_t size;
+    size_t touchedPages;
+    uint64_t checksum;
+};
+
 class Node : public SST::Component {
 public:
     Node(SST::ComponentId_t id, SST::Params& params);
@@ -24,7 +60,7 @@ public:
 
     bool tick(SST::Cycle_t currentCycle);
 
-    void handleEvent(SST::Event* ev);
+    void handleEvent(SST::Event* ev, size_t port);
 
     SST::Interfaces::StringEvent* createEvent();
 
@@ -75,10 +111,15 @@ public:
          "0"},
         {"componentSize",
          "Additional size of components in bytes",
-         "0"})
+         "0"},
+        {"componentTouchFraction",
+         "Fraction of componentSize pages written at startup [0,1]",
+         "1.0"})
 
     SST_ELI_DOCUMENT_PORTS({{"port%d", "Ports to others", {}}})
 
+    SST_ELI_DOCUMENT_STATISTICS(RUNDIGEST_ELI_STATISTICS, PERFSTATS_ELI_STATISTICS)
+
     template <typename T>
     void setupLinks()
     {
@@ -87,7 +128,7 @@ public:
         for (size_t i = 0; i < links.size(); i++) {
             std::string portName = "port" + std::to_string(i);
             auto* evHandler = new SST::Event::Handler2<
-                Node, &Node::handleEvent>(this);
+                Node, &Node::handleEvent, size_t>(this, i);
             links[i] = configureLink(portName, evHandler);
             if (links[i] == nullptr) {
                 // Link not configured; leave nullptr.
@@ -104,10 +145,19 @@ public:
     std::string timeToRun;
     int smallPayload, largePayload;
     double largeEventFraction;
-    char* additionalData;
+    ComponentBuffer additionalData;
 
     int recvCount;
 
+    // Order-independent digest of received events, reported at finish
+    rundigest::RunDigest runDigest;
+
+    // Component output handler
+    SST::Output output;
+
+    // Hardware counters of the component's thread, reported at finish
+    perfstats::PerfStats perfStats;
+
     // SST RNG system for checkpoint serialization
     SST::RNG::MersenneRNG* rng;
 
@@ -0,0 +1,191 @@
+//
+// _cptstats_h_
+//
+// Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+// All Rights Reserved
+// contact@tactcomplabs.com
+//
+// See LICENSE in the top level directory for licensing details
+//
+// Per-component checkpoint instrumentation. A component owns a CptStats
+// object, registers its four statistics in the constructor and brackets
+// its serialize_order with begin()/end():
+//
+//   SST_ELI_DOCUMENT_STATISTICS( CPTSTATS_ELI_STATISTICS )
+//
+//   cptStats.registerStats(registerStatistic<uint64_t>("CPT_SER_NS"),
+//                          registerStatistic<uint64_t>("CPT_SER_BYTES"),
+//                          registerStatistic<uint64_t>("CPT_DESER_NS"),
+//                          registerStatistic<uint64_t>("CPT_DESER_BYTES"));
+//
+//   void Comp::serialize_order(serializer& ser){
+//     cptStats.begin(ser);
+//     SST::Component::serialize_order(ser);
+//     ...
+//     cptStats.serialize_order(ser);
+//     cptStats.end(ser);
+//   }
+//
+// Serialize time is the sum of the SIZER and PACK passes and is recorded
+// once per checkpoint by the run that writes it. Deserialize samples are
+// held until the restarted component calls flush() (first clock tick or
+// finish) so they land in the restored statistics.
+//
+// Deserialize samples are also summed over the components of the library
+// on each rank. After a restart the first component on the rank to call
+// report() in finish() prints them as a single line parsed by
+// sqlutils.py restart-info:
+//
+//   void Comp::finish(){ cptStats.report(output, getRank().rank); }
+//
+
+#ifndef _CPTSTATS_H
+#define _CPTSTATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+
+#include "SST.h"
+
+/// ELI statistic entries for SST_ELI_DOCUMENT_STATISTICS
+#define CPTSTATS_ELI_STATISTICS                                                          \
+  {"CPT_SER_NS",      "Wall time to serialize the component per checkpoint",  "ns",    1}, \
+  {"CPT_SER_BYTES",   "Serialized component bytes per checkpoint",            "bytes", 1}, \
+  {"CPT_DESER_NS",    "Wall time to deserialize the component on restart",    "ns",    1}, \
+  {"CPT_DESER_BYTES", "Deserialized component bytes on restart",              "bytes", 1}
+
+namespace cptstats {
+
+/// deserialize totals of the components on this rank
+struct RestartTotals {
+  std::atomic<uint64_t> components{ 0 };   ///< components restored
+  std::atomic<uint64_t> ns{ 0 };           ///< summed deserialize time
+  std::atomic<uint64_t> maxNs{ 0 };        ///< longest component deserialize time
+  std::atomic<uint64_t> bytes{ 0 };        ///< summed deserialized bytes
+  std::atomic<bool>     reported{ false }; ///< report() printed
+
+  void add( uint64_t n, uint64_t b ) {
+    components.fetch_add( 1, std::memory_order_relaxed );
+    ns.fetch_add( n, std::memory_order_relaxed );
+    bytes.fetch_add( b, std::memory_order_relaxed );
+    uint64_t m = maxNs.load( std::memory_order_relaxed );
+    while( n > m && !maxNs.compare_exchange_weak( m, n, std::memory_order_relaxed ) ) {
+    }
+  }
+};
+
+static inline RestartTotals& restartTotals() {
+  static RestartTotals t;
+  return t;
+}
+
+class CptStats {
+public:
+  using Stat       = SST::Statistics::Statistic<uint64_t>;
+  using serializer = SST::Core::Serialization::serializer;
+
+  /// CptStats: attach the registered statistics
+  void registerStats( Stat* serNs, Stat* serBytes, Stat* deserNs, Stat* deserBytes ) {
+    SerNs      = serNs;
+    SerBytes   = serBytes;
+    DeserNs    = deserNs;
+    DeserBytes = deserBytes;
+  }
+
+  /// CptStats: start timing a serialization pass
+  void begin( serializer& ser ) {
+    startBytes = ser.size();
+    start      = std::chrono::steady_clock::now();
+  }
+
+  /// CptStats: finish timing a serialization pass
+  void end( serializer& ser ) {
+    uint64_t ns    = elapsedNs();
+    uint64_t bytes = ser.size() - startBytes;
+    switch( ser.mode() ) {
+    case serializer::SIZER:
+      sizerNs = ns;
+      break;
+    case serializer::PACK:
+      addData( SerNs, sizerNs + ns );
+      addData( SerBytes, bytes );
+      sizerNs = 0;
+      break;
+    case serializer::UNPACK:
+      pendingNs    = ns;
+      pendingBytes = bytes;
+      pending      = true;
+      restartTotals().add( ns, bytes );
+      break;
+    default:
+      break;
+    }
+  }
+
+  /// CptStats: serialize the statistic handles
+  void serialize_order( serializer& ser ) {
+    SST_SER( SerNs );
+    SST_SER( SerBytes );
+    SST_SER( DeserNs );
+    SST_SER( DeserBytes );
+  }
+
+  /// CptStats: record the deserialize sample after a restart
+  void flush() {
+    if( !pending )
+      return;
+    addData( DeserNs, pendingNs );
+    addData( DeserBytes, pendingBytes );
+    pending = false;
+  }
+
+  /// CptStats: print the rank's restart totals once; nothing without a restart
+  void report( SST::Output& out, uint32_t rank ) const {
+    RestartTotals& t = restartTotals();
+    if( t.components.load() == 0 || t.reported.exchange( true ) )
+      return;
+    out.output( "cptstats: rank=%" PRIu32 " components=%" PRIu64 " deser_ns=%" PRIu64 " deser_max_ns=%" PRIu64
+                " deser_bytes=%" PRIu64 "\n",
+                rank,
+                t.components.load(),
+                t.ns.load(),
+                t.maxNs.load(),
+                t.bytes.load() );
+  }
+
+  /// CptStats: deserialize wall time awaiting flush()
+  uint64_t getPendingNs() const { return pendingNs; }
+
+  /// CptStats: deserialized bytes awaiting flush()
+  uint64_t getPendingBytes() const { return pendingBytes; }
+
+private:
+  Stat* SerNs      = nullptr;  ///< serialize wall time statistic
+  Stat* SerBytes   = nullptr;  ///< serialized bytes statistic
+  Stat* DeserNs    = nullptr;  ///< deserialize wall time statistic
+  Stat* DeserBytes = nullptr;  ///< deserialized bytes statistic
+
+  // -- transient state; never serialized
+  std::chrono::steady_clock::time_point start{};  ///< pass start time
+  size_t   startBytes   = 0;                       ///< serializer offset at begin()
+  uint64_t sizerNs      = 0;                       ///< SIZER pass time of the current checkpoint
+  uint64_t pendingNs    = 0;                       ///< deserialize time awaiting flush()
+  uint64_t pendingBytes = 0;                       ///< deserialize bytes awaiting flush()
+  bool     pending      = false;                   ///< deserialize sample awaiting flush()
+
+  uint64_t elapsedNs() const {
+    return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start ).count();
+  }
+
+  static void addData( Stat* stat, uint64_t v ) {
+    if( stat )
+      stat->addData( v );
+  }
+};  // class CptStats
+
+}  // namespace cptstats
+
+#endif  // _CPTSTATS_H
@@ -0,0 +1,178 @@
+//
+// _perfstats_h_
+//
+// Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+// All Rights Reserved
+// contact@tactcomplabs.com
+//
+// See LICENSE in the top level directory for licensing details
+//
+// Per-thread hardware counters for the simulation phase. The first
+// component on each thread to call start() in setup() opens user space
+// cycles, instructions, cache miss and branch miss counters for the
+// thread; the first component on the thread to call stop() in finish()
+// reads them into its statistics and prints a single report line:
+//
+//   SST_ELI_DOCUMENT_STATISTICS( PERFSTATS_ELI_STATISTICS )
+//
+//   perfStats.registerStats(registerStatistic<uint64_t>("PERF_CYCLES"),
+//                           registerStatistic<uint64_t>("PERF_INSTRUCTIONS"),
+//                           registerStatistic<uint64_t>("PERF_CACHE_MISSES"),
+//                           registerStatistic<uint64_t>("PERF_BRANCH_MISSES"));
+//   void Comp::setup(){ perfStats.start(); }
+//   void Comp::finish(){ perfStats.stop(output); }
+//
+// The counters cover the SST core as well as component code on the
+// thread. Counters that cannot be opened (no perf_event support, a
+// restrictive perf_event_paranoid, or a virtualized PMU) are skipped;
+// when none open the helper does nothing. Multiplexed counts are scaled
+// by time enabled over time running. The report line is parsed by
+// sqlutils.py perf-info.
+//
+
+#ifndef _PERFSTATS_H
+#define _PERFSTATS_H
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+#include "SST.h"
+
+/// ELI statistic entries for SST_ELI_DOCUMENT_STATISTICS
+#define PERFSTATS_ELI_STATISTICS                                                              \
+  {"PERF_CYCLES",        "User space cycles of the component's thread",         "cycles", 1}, \
+  {"PERF_INSTRUCTIONS",  "User space instructions of the component's thread",   "instrs", 1}, \
+  {"PERF_CACHE_MISSES",  "Last level cache misses of the component's thread",   "misses", 1}, \
+  {"PERF_BRANCH_MISSES", "Branch mispredictions of the component's thread",     "misses", 1}
+
+namespace perfstats {
+
+enum Counter : unsigned { CYCLES = 0, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, NUM_COUNTERS };
+
+/// report keys, in Counter order
+static const char* const CounterNames[NUM_COUNTERS] = { "cycles", "instructions", "cache-misses", "branch-misses" };
+
+/// counters of the calling thread
+class ThreadCounters {
+public:
+  ~ThreadCounters() {
+    for( int& fd : fds ) {
+      if( fd >= 0 )
+        close( fd );
+      fd = -1;
+    }
+  }
+
+  /// ThreadCounters: open the counters once per thread
+  void open() {
+    if( tried )
+      return;
+    tried = true;
+#ifdef __linux__
+    static const uint64_t configs[NUM_COUNTERS] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+    for( unsigned i = 0; i < NUM_COUNTERS; i++ ) {
+      struct perf_event_attr attr;
+      memset( &attr, 0, sizeof( attr ) );
+      attr.size           = sizeof( attr );
+      attr.type           = PERF_TYPE_HARDWARE;
+      attr.config         = configs[i];
+      attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      fds[i]              = (int) syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 );
+      if( fds[i] >= 0 )
+        opened = true;
+    }
+#endif
+  }
+
+  /// ThreadCounters: claim the report; true for the first caller with open counters
+  bool claim() {
+    if( !opened || reported )
+      return false;
+    reported = true;
+    return true;
+  }
+
+  /// ThreadCounters: scaled value of counter `c`; false when unavailable
+  bool read( unsigned c, uint64_t& value ) const {
+    uint64_t buf[3] = { 0, 0, 0 };  // value, time enabled, time running
+    if( fds[c] < 0 || ::read( fds[c], buf, sizeof( buf ) ) != (ssize_t) sizeof( buf ) )
+      return false;
+    value = buf[0];
+    if( buf[2] > 0 && buf[2] < buf[1] )
+      value = (uint64_t) ( (double) buf[0] * (double) buf[1] / (double) buf[2] );
+    return true;
+  }
+
+private:
+  int  fds[NUM_COUNTERS] = { -1, -1, -1, -1 };  ///< per counter file descriptors
+  bool tried             = false;               ///< open() attempted
+  bool opened            = false;               ///< at least one counter opened
+  bool reported          = false;               ///< stop() reported this thread
+};  // class ThreadCounters
+
+/// counters of the calling thread; external linkage so every component
+/// library loaded into the process shares one set per thread
+inline ThreadCounters& threadCounters() {
+  thread_local ThreadCounters t;
+  return t;
+}
+
+class PerfStats {
+public:
+  using Stat       = SST::Statistics::Statistic<uint64_t>;
+  using serializer = SST::Core::Serialization::serializer;
+
+  /// PerfStats: attach the registered statistics
+  void registerStats( Stat* cycles, Stat* instrs, Stat* cacheMisses, Stat* branchMisses ) {
+    Stats[CYCLES]        = cycles;
+    Stats[INSTRUCTIONS]  = instrs;
+    Stats[CACHE_MISSES]  = cacheMisses;
+    Stats[BRANCH_MISSES] = branchMisses;
+  }
+
+  /// PerfStats: start counting on the calling thread
+  void start() { threadCounters().open(); }
+
+  /// PerfStats: record and report the calling thread's counts once
+  void stop( SST::Output& out ) {
+    ThreadCounters& t = threadCounters();
+    if( !t.claim() )
+      return;
+    std::string line = "perfstats:";
+    for( unsigned c = 0; c < NUM_COUNTERS; c++ ) {
+      uint64_t v = 0;
+      if( !t.read( c, v ) )
+        continue;
+      if( Stats[c] )
+        Stats[c]->addData( v );
+      line += " " + std::string( CounterNames[c] ) + "=" + std::to_string( v );
+    }
+    out.output( "%s\n", line.c_str() );
+  }
+
+  /// PerfStats: serialize the statistic handles
+  void serialize_order( serializer& ser ) {
+    SST_SER( Stats[CYCLES] );
+    SST_SER( Stats[INSTRUCTIONS] );
+    SST_SER( Stats[CACHE_MISSES] );
+    SST_SER( Stats[BRANCH_MISSES] );
+  }
+
+private:
+  Stat* Stats[NUM_COUNTERS] = { nullptr, nullptr, nullptr, nullptr };  ///< per counter statistics
+};  // class PerfStats
+
+}  // namespace perfstats
+
+#endif  // _PERFSTATS_H
@@ -0,0 +1,180 @@
+//
+// _rundigest_h_
+//
+// Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+// All Rights Reserved
+// contact@tactcomplabs.com
+//
+// See LICENSE in the top level directory for licensing details
+//
+// Per-component run digest. Each recorded event is hashed together with
+// its delivery time and port, and the event hashes are summed modulo 2^64.
+// The sum does not depend on the delivery order of simultaneous events, so
+// the digests summed over all components must be identical for any rank or
+// thread count and for runs restarted from a checkpoint:
+//
+//   SST_ELI_DOCUMENT_STATISTICS( RUNDIGEST_ELI_STATISTICS )
+//
+//   runDigest.registerStat(registerStatistic<uint64_t>("RUN_DIGEST"));
+//   runDigest.add(getCurrentSimTime(), port, ev->getData());
+//   runDigest.serialize_order(ser);
+//   void Comp::finish(){
+//     output.verbose(CALL_INFO, 1, 0, "%s %s\n", getName().c_str(),
+//                    runDigest.str().c_str());
+//     runDigest.report(output, getRank().rank);
+//   }
+//
+// report() adds the component's digest to the totals of its rank; the last
+// component of the rank to finish prints them as a single 'rundigest: ...'
+// line parsed by sqlutils.py digest-info. The rank line is printed at every
+// verbosity so the sweeper can compare jobs; the component's Output is
+// serialized so restarted runs report too.
+//
+// When enabled as an accumulator the RUN_DIGEST statistic receives every
+// event hash, so its Sum.u64 field equals the digest.
+//
+
+#ifndef _RUNDIGEST_H
+#define _RUNDIGEST_H
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "SST.h"
+
+/// ELI statistic entry for SST_ELI_DOCUMENT_STATISTICS
+#define RUNDIGEST_ELI_STATISTICS \
+  {"RUN_DIGEST", "Hash of each received event; Sum is the run digest", "hash", 1}
+
+namespace rundigest {
+
+static constexpr uint64_t P1 = 0x9E3779B185EBCA87ull;
+static constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+static constexpr uint64_t P3 = 0x165667B19E3779F9ull;
+
+/// xxhash64 style accumulate of a single 64 bit word
+static inline uint64_t mix( uint64_t acc, uint64_t v ) {
+  acc += v * P2;
+  acc = ( acc << 31 ) | ( acc >> 33 );
+  return acc * P1;
+}
+
+/// xxhash64 style final avalanche
+static inline uint64_t avalanche( uint64_t h ) {
+  h ^= h >> 33;
+  h *= P2;
+  h ^= h >> 29;
+  h *= P3;
+  h ^= h >> 32;
+  return h;
+}
+
+/// hash of a single event
+static inline uint64_t hashEvent( uint64_t time, uint64_t port, const void* data, size_t bytes ) {
+  const uint8_t* p = static_cast<const uint8_t*>( data );
+  uint64_t       h = mix( mix( mix( P3, time ), port ), bytes );
+  size_t         i = 0;
+  for( ; i + sizeof( uint64_t ) <= bytes; i += sizeof( uint64_t ) ) {
+    uint64_t w;
+    memcpy( &w, p + i, sizeof( uint64_t ) );
+    h = mix( h, w );
+  }
+  uint64_t tail = 0;
+  if( i < bytes )
+    memcpy( &tail, p + i, bytes - i );
+  return avalanche( mix( h, tail ) );
+}
+
+/// digest totals of the components on this rank
+struct RankTotals {
+  std::atomic<uint64_t> components{ 0 };  ///< constructed or restored RunDigest objects
+  std::atomic<uint64_t> finished{ 0 };    ///< components that called report()
+  std::atomic<uint64_t> digest{ 0 };      ///< summed component digests
+  std::atomic<uint64_t> events{ 0 };      ///< summed component event counts
+};
+
+/// totals of the rank; external linkage so every component library loaded
+/// into the process adds to the same totals
+inline RankTotals& rankTotals() {
+  static RankTotals t;
+  return t;
+}
+
+class RunDigest {
+public:
+  using Stat       = SST::Statistics::Statistic<uint64_t>;
+  using serializer = SST::Core::Serialization::serializer;
+
+  /// RunDigest: count the component in the totals of its rank
+  RunDigest() { rankTotals().components.fetch_add( 1 ); }
+  RunDigest( const RunDigest& )            = delete;
+  RunDigest& operator=( const RunDigest& ) = delete;
+
+  /// RunDigest: attach the optional RUN_DIGEST statistic
+  void registerStat( Stat* stat ) { DigestStat = stat; }
+
+  /// RunDigest: record an event delivered at `time` on `port`
+  void add( uint64_t time, uint64_t port, const void* data, size_t bytes ) {
+    uint64_t h = hashEvent( time, port, data, bytes );
+    digest += h;
+    events++;
+    if( DigestStat )
+      DigestStat->addData( h );
+  }
+
+  /// RunDigest: record an event carrying a vector payload
+  template<typename T>
+  void add( uint64_t time, uint64_t port, const std::vector<T>& data ) {
+    add( time, port, data.data(), data.size() * sizeof( T ) );
+  }
+
+  /// RunDigest: record an event carrying a string payload
+  void add( uint64_t time, uint64_t port, const std::string& data ) { add( time, port, data.data(), data.size() ); }
+
+  /// RunDigest: current digest
+  uint64_t value() const { return digest; }
+
+  /// RunDigest: number of recorded events
+  uint64_t count() const { return events; }
+
+  /// RunDigest: digest report of this component
+  std::string str() const {
+    char buf[64];
+    snprintf( buf, sizeof( buf ), "digest=0x%016" PRIx64 " events=%" PRIu64, digest, events );
+    return std::string( buf );
+  }
+
+  /// RunDigest: add this component to the rank totals; the last one prints them
+  void report( SST::Output& out, uint32_t rank ) const {
+    RankTotals& t = rankTotals();
+    t.digest.fetch_add( digest );
+    t.events.fetch_add( events );
+    if( t.finished.fetch_add( 1 ) + 1 != t.components.load() )
+      return;
+    out.output( "rundigest: rank=%" PRIu32 " components=%" PRIu64 " digest=0x%016" PRIx64 " events=%" PRIu64 "\n",
+                rank,
+                t.finished.load(),
+                t.digest.load(),
+                t.events.load() );
+  }
+
+  /// RunDigest: serialize the digest state
+  void serialize_order( serializer& ser ) {
+    SST_SER( digest );
+    SST_SER( events );
+    SST_SER( DigestStat );
+  }
+
+private:
+  uint64_t digest     = 0;        ///< sum of the event hashes
+  uint64_t events     = 0;        ///< number of recorded events
+  Stat*    DigestStat = nullptr;  ///< optional per-event hash statistic
+};  // class RunDigest
+
+}  // namespace rundigest
+
+#endif  // _RUNDIGEST_H
@@ -0,0 +1,203 @@
+//
+// _scopeprof_h_
+//
+// Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+// All Rights Reserved
+// contact@tactcomplabs.com
+//
+// See LICENSE in the top level directory for licensing details
+//
+// Opt-in scoped timers for component hot paths. Built with
+// -DSSTBENCH_ENABLE_PROFILE=ON (which defines SSTBENCH_PROFILE) each
+// SCOPEPROF region accumulates its call count and elapsed ticks into
+// per-thread counters; otherwise the macros compile to nothing:
+//
+//   bool Comp::clockTick( SST::Cycle_t cycle ){
+//     SCOPEPROF("Comp::clockTick");
+//     ...
+//   }
+//
+//   void Comp::finish(){
+//     SCOPEPROF_REPORT(output);
+//   }
+//
+// Ticks are TSC cycles on x86 and CLOCK_MONOTONIC nanoseconds elsewhere.
+// Regions are inclusive of nested regions. Registry::get() has external
+// linkage, so every component library loaded into a process shares one
+// registry, and the report of all their regions is printed once per process
+// by the first finish() to call it, which runs after every thread has left
+// the run loop. %wall is the region time
+// over the summed lifetime of the threads that entered a region, so the
+// remainder approximates time spent in the SST core.
+//
+
+#ifndef _SCOPEPROF_H
+#define _SCOPEPROF_H
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <time.h>
+#include <vector>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#endif
+
+#include "SST.h"
+
+namespace scopeprof {
+
+static constexpr unsigned MAX_REGIONS = 64;  ///< regions per process
+
+/// raw timestamp
+static inline uint64_t now() {
+#if defined( __x86_64__ ) || defined( __i386__ )
+  return __rdtsc();
+#else
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+/// single writer counter; the owning thread never needs a locked RMW
+struct Counter {
+  std::atomic<uint64_t> value{ 0 };
+
+  void add( uint64_t v ) { value.store( value.load( std::memory_order_relaxed ) + v, std::memory_order_relaxed ); }
+
+  uint64_t get() const { return value.load( std::memory_order_relaxed ); }
+};
+
+/// per-thread region counters
+struct ThreadTable {
+  Counter calls[MAX_REGIONS];  ///< region entries
+  Counter ticks[MAX_REGIONS];  ///< region ticks
+  uint64_t start = now();      ///< first region entry on the thread
+};
+
+class Registry {
+public:
+  /// Registry: process wide instance shared by the component libraries
+  static Registry& get() {
+    static Registry r;
+    return r;
+  }
+
+  /// Registry: region id for `name`; called once per SCOPEPROF site
+  unsigned region( const char* name ) {
+    std::lock_guard<std::mutex> lock( mutex );
+    for( unsigned i = 0; i < names.size(); i++ ) {
+      if( names[i] == name )
+        return i;
+    }
+    if( names.size() == MAX_REGIONS - 1 )
+      names.emplace_back( "(overflow)" );
+    if( names.size() == MAX_REGIONS )
+      return MAX_REGIONS - 1;
+    names.emplace_back( name );
+    return (unsigned) ( names.size() - 1 );
+  }
+
+  /// Registry: counters of the calling thread
+  ThreadTable* table() {
+    thread_local ThreadTable* t = attach();
+    return t;
+  }
+
+  /// Registry: print the aggregate of all threads once
+  void report( SST::Output& out ) {
+    if( reported.exchange( true ) )
+      return;
+    std::lock_guard<std::mutex> lock( mutex );
+    const uint64_t endTicks = now();
+    const double   endNs    = nowNs();
+
+    // ticks per ns from the interval since the registry was created
+    double tickNs = 1.0;
+    if( endNs > startNs && endTicks > startTicks )
+      tickNs = (double) ( endTicks - startTicks ) / ( endNs - startNs );
+
+    double wallTicks = 0.0;
+    for( const auto& t : tables )
+      wallTicks += (double) ( endTicks - t->start );
+
+    out.output( "scopeprof: %zu threads, %.3f ticks/ns\n", tables.size(), tickNs );
+    out.output( "scopeprof: %-32s %14s %18s %12s %12s %7s\n", "region", "calls", "ticks", "ticks/call", "sec", "%wall" );
+    for( unsigned i = 0; i < names.size(); i++ ) {
+      uint64_t calls = 0;
+      uint64_t ticks = 0;
+      for( const auto& t : tables ) {
+        calls += t->calls[i].get();
+        ticks += t->ticks[i].get();
+      }
+      out.output( "scopeprof: %-32s %14" PRIu64 " %18" PRIu64 " %12.1f %12.6f %6.2f%%\n",
+                  names[i].c_str(),
+                  calls,
+                  ticks,
+                  calls ? (double) ticks / (double) calls : 0.0,
+                  (double) ticks / tickNs / 1e9,
+                  wallTicks > 0.0 ? 100.0 * (double) ticks / wallTicks : 0.0 );
+    }
+  }
+
+private:
+  std::mutex                                mutex;                ///< guards names and tables
+  std::vector<std::string>                  names;                ///< region names by id
+  std::vector<std::unique_ptr<ThreadTable>> tables;               ///< one per thread; outlive the threads
+  std::atomic<bool>                         reported{ false };    ///< report printed
+  const uint64_t                            startTicks = now();   ///< calibration start
+  const double                              startNs    = nowNs();  ///< calibration start
+
+  Registry() = default;
+
+  static double nowNs() {
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch() )
+      .count();
+  }
+
+  ThreadTable* attach() {
+    std::lock_guard<std::mutex> lock( mutex );
+    tables.emplace_back( new ThreadTable() );
+    return tables.back().get();
+  }
+};  // class Registry
+
+/// times the enclosing scope into region `id` of the calling thread
+class ScopedTimer {
+public:
+  explicit ScopedTimer( unsigned id ) : table( Registry::get().table() ), id( id ), start( now() ) {}
+
+  ~ScopedTimer() {
+    table->ticks[id].add( now() - start );
+    table->calls[id].add( 1 );
+  }
+
+  ScopedTimer( const ScopedTimer& )            = delete;
+  ScopedTimer& operator=( const ScopedTimer& ) = delete;
+
+private:
+  ThreadTable* table;
+  unsigned     id;
+  uint64_t     start;
+};  // class ScopedTimer
+
+}  // namespace scopeprof
+
+#ifdef SSTBENCH_PROFILE
+#define SCOPEPROF( name )                                                                  \
+  static const unsigned _scopeprof_id = scopeprof::Registry::get().region( name );          \
+  scopeprof::ScopedTimer _scopeprof_timer( _scopeprof_id )
+#define SCOPEPROF_REPORT( out ) scopeprof::Registry::get().report( out )
+#else
+#define SCOPEPROF( name )
+#define SCOPEPROF_REPORT( out )
+#endif
+
+#endif  // _SCOPEPROF_H
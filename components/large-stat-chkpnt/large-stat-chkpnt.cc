@@ -17,7 +17,8 @@ namespace SST::LargeStatChkpnt{
   //------------------------------------------
   LargeStatChkpnt::LargeStatChkpnt(SST::ComponentId_t id, const SST::Params& params ) :
     SST::Component( id ), clockHandler(nullptr),
-    numStats(1), numClocks(1) {
+    numStats(1), numClocks(1), dumpPeriod(0), numDumps(0), dumpNs(0),
+    sampleStride(1), ticks(0), statBytes(0), restored(false) {
     const uint32_t Verbosity = params.find< uint32_t >( "verbose", 0 );
     output.init(
       "LargeStatChkpnt[" + getName() + ":@p:@t]: ",
@@ -32,6 +33,8 @@ namespace SST::LargeStatChkpnt{
     // read the remainder of the parameters
     numStats = params.find<uint64_t>( "numStats", 1 );
     numClocks = params.find<uint64_t>( "numClocks", 1);
+    dumpPeriod = params.find<uint64_t>( "dumpPeriod", 0 );
+    sampleStride = params.find<uint64_t>( "sampleStride", 1 );
     
     output.verbose( CALL_INFO, 0, 0, "numStats=%" PRIu64 "\n", numStats );
     output.verbose( CALL_INFO, 0, 0, "numClocks=%" PRIu64 "\n", numClocks );
@@ -50,20 +53,124 @@ namespace SST::LargeStatChkpnt{
   }
 
   void LargeStatChkpnt::finish(){
+    verifyStats("finish");
+    output.verbose( CALL_INFO, 1, 0,
+                    "checkpoint stat bytes=%" PRIu64 " bytesPerStat=%.3f\n",
+                    statBytes,
+                    numStats ? (double)(statBytes) / (double)(numStats) : 0. );
+    if( dumpPeriod > 0 ){
+      output.verbose( CALL_INFO, 1, 0,
+                      "rank=%" PRIu32 " dumps=%" PRIu64 " dumpNs=%" PRIu64 " nsPerDump=%.3f\n",
+                      getRank().rank, numDumps, dumpNs,
+                      numDumps ? (double)(dumpNs) / (double)(numDumps) : 0. );
+    }
+  }
+
+  void LargeStatChkpnt::dumpStats(){
+    auto start = std::chrono::steady_clock::now();
+    for( auto* stat : VStat ){
+      // statistics that are not enabled have no output
+      if( !stat->isNullStatistic() )
+        performStatisticOutput(stat);
+    }
+    dumpNs += (uint64_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+    numDumps++;
   }
 
   void LargeStatChkpnt::init( unsigned int phase ){
   }
 
+  void LargeStatChkpnt::sampleStats(){
+    if( sampleStride == 0 )
+      return;
+    // stat n is sampled when (ticks + n) is a multiple of the stride
+    for( uint64_t n = (sampleStride - (ticks % sampleStride)) % sampleStride;
+         n < numStats; n += sampleStride ){
+      VStat[n]->addData(ticks + n);
+    }
+  }
+
+  void LargeStatChkpnt::verifyStats( const char* when ){
+    if( sampleStride == 0 )
+      return;
+    uint64_t checked = 0;
+    for( uint64_t n = 0; n < numStats; n++ ){
+      if( VStat[n]->isNullStatistic() )
+        continue;
+      // the samples are the multiples k*sampleStride of [n, ticks + n)
+      const uint64_t kLo = (n + sampleStride - 1) / sampleStride;
+      const uint64_t kHi = (ticks + n + sampleStride - 1) / sampleStride;
+      const uint64_t expected = kHi - kLo;
+      const uint64_t actual = VStat[n]->getCollectionCount();
+      if( actual != expected ){
+        output.fatal(CALL_INFO, -1,
+                     "Error: STAT_%" PRIu64 " holds %" PRIu64 " samples at %s; expected %" PRIu64 "\n",
+                     n, actual, when, expected);
+      }
+      // accumulators also carry the sum of the samples
+      auto* acc = dynamic_cast<Statistics::AccumulatorStatistic<uint64_t>*>(VStat[n]);
+      if( acc != nullptr ){
+        const uint64_t expectedSum = sampleStride * ((kLo + kHi - 1) * expected / 2);
+        const uint64_t actualSum = acc->getSum();
+        if( actualSum != expectedSum ){
+          output.fatal(CALL_INFO, -1,
+                       "Error: STAT_%" PRIu64 " sums to %" PRIu64 " at %s; expected %" PRIu64 "\n",
+                       n, actualSum, when, expectedSum);
+        }
+      }
+      checked++;
+    }
+    // a restart that verifies nothing would pass silently
+    if( checked == 0 && restored ){
+      output.fatal(CALL_INFO, -1,
+                   "Error: no enabled statistics to verify at %s\n", when);
+    }
+    output.verbose( CALL_INFO, 1, 0, "verified %" PRIu64 " statistics at %s\n",
+                    checked, when );
+  }
+
   void LargeStatChkpnt::serialize_order(SST::Core::Serialization::serializer& ser){
     SST::Component::serialize_order(ser);
     SST_SER(clockHandler);
     SST_SER(numStats);
     SST_SER(numClocks);
+    SST_SER(dumpPeriod);
+    SST_SER(numDumps);
+    SST_SER(dumpNs);
+    SST_SER(sampleStride);
+    SST_SER(ticks);
+
+    // record the marginal checkpoint cost of the statistics
+    const bool sizing =
+      ser.mode() == SST::Core::Serialization::serializer::SIZER;
+    const size_t before = sizing ? ser.size() : 0;
     SST_SER(VStat);
+    if( sizing ){
+      statBytes = (uint64_t)(ser.size() - before);
+      output.verbose( CALL_INFO, 2, 0,
+                      "checkpoint stat bytes=%" PRIu64 " bytesPerStat=%.3f\n",
+                      statBytes,
+                      numStats ? (double)(statBytes) / (double)(numStats) : 0. );
+    }
+    SST_SER(statBytes);
+
+    if( ser.mode() == SST::Core::Serialization::serializer::UNPACK )
+      restored = true;
   }
 
   bool LargeStatChkpnt::clockTick( SST::Cycle_t currentCycle ){
+    if( restored ){
+      verifyStats("restart");
+      restored = false;
+    }
+
+    sampleStats();
+    ticks++;
+
+    if( dumpPeriod > 0 && ((uint64_t)(currentCycle) % dumpPeriod) == 0 )
+      dumpStats();
+
     if( (uint64_t)(currentCycle) >= numClocks ){
       primaryComponentOKToEndSim();
       return true;
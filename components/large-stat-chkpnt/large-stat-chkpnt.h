@@ -13,11 +13,12 @@
 
 // clang-format off
 // -- Standard Headers
+#include <chrono>
 #include <vector>
 #include <queue>
 #include <stdio.h>
 #include <stdlib.h>
-// #include <inttypes.h>
+#include <inttypes.h>
 #include <time.h>
 
 // -- SST Headers
@@ -64,6 +65,8 @@ public:
     {"verbose",         "Sets the verbosity level of output",           "0" },
     {"numStats",        "Sets the number of stats to create",           "1" },
     {"numClocks",       "Sets the number of clock cycles to execute",   "1" },
+    {"dumpPeriod",      "Sets the number of cycles between statistic dumps (0 disables)", "0" },
+    {"sampleStride",    "Stat n is sampled on ticks where (tick+n) % sampleStride == 0 (0 disables)", "1" },
   )
 
   // -------------------------------------------------------
@@ -98,9 +101,25 @@ private:
 
   uint64_t numStats;                              ///< Number of stats to create
   uint64_t numClocks;                             ///< Number of clock cycles to run
+  uint64_t dumpPeriod;                            ///< Cycles between statistic dumps
+  uint64_t numDumps;                              ///< Number of statistic dumps
+  uint64_t dumpNs;                                ///< Wall clock ns spent in dumps
+  uint64_t sampleStride;                          ///< Deterministic sampling stride
+  uint64_t ticks;                                 ///< Number of clock ticks executed
+  uint64_t statBytes;                             ///< Checkpoint bytes of the last stat vector
+  bool restored;                                  ///< Set when restored from a checkpoint
 
   std::vector<Statistic<uint64_t>*> VStat;        ///< Statistics vector
 
+  /// LargeStatChkpnt: add the deterministic samples for the current tick
+  void sampleStats();
+
+  /// LargeStatChkpnt: verify every statistic holds the expected samples
+  void verifyStats( const char* when );
+
+  /// LargeStatChkpnt: output all of this component's statistics
+  void dumpStats();
+
 };  // class LargeStatChkpnt
 }   // namespace SST::LargeStatChkpnt
 
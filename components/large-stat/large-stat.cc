@@ -17,7 +17,11 @@ namespace SST::LargeStat{
   //------------------------------------------
   LargeStat::LargeStat(SST::ComponentId_t id, const SST::Params& params ) :
     SST::Component( id ), clockHandler(nullptr),
-    numStats(1) {
+    numStats(1), numClocks(1), sampling(false), mode(SampleMode::ALL),
+    samplesPerTick(1), valueRange(1024), rrIndex(0), numSamples(0),
+    sampleNs(0), dumpPeriod(0), numDumps(0), dumpNs(0),
+    regMode(RegisterMode::EAGER), rngSeed(31337), numRegistered(0),
+    registerNs(0), localRNG(nullptr), VecStat(nullptr) {
     const uint32_t Verbosity = params.find< uint32_t >( "verbose", 0 );
     output.init(
       "LargeStat[" + getName() + ":@p:@t]: ",
@@ -30,29 +34,185 @@ namespace SST::LargeStat{
 
     // read the remainder of the parameters
     numStats = params.find<uint64_t>( "numStats", 1 );
+    numClocks = params.find<uint64_t>( "numClocks", 1 );
+    samplesPerTick = params.find<uint64_t>( "samplesPerTick", 1 );
+    valueRange = params.find<uint64_t>( "valueRange", 1024 );
+    dumpPeriod = params.find<uint64_t>( "dumpPeriod", 0 );
+    rngSeed = params.find<uint32_t>( "rngSeed", 31337 );
+    const std::string sampleMode = params.find<std::string>( "sampleMode", "none" );
+    const std::string registerMode = params.find<std::string>( "registerMode", "eager" );
+
+    if( numClocks == 0 )
+      output.fatal(CALL_INFO, -1, "Error: numClocks must be at least 1\n");
+    if( valueRange == 0 )
+      output.fatal(CALL_INFO, -1, "Error: valueRange must be at least 1\n");
+
+    if( sampleMode == "none" ){
+      sampling = false;
+    }else if( sampleMode == "all" ){
+      sampling = true;
+      mode = SampleMode::ALL;
+    }else if( sampleMode == "random" ){
+      sampling = true;
+      mode = SampleMode::RANDOM;
+    }else if( sampleMode == "roundrobin" ){
+      sampling = true;
+      mode = SampleMode::ROUNDROBIN;
+    }else{
+      output.fatal(CALL_INFO, -1, "Error: unknown sampleMode: %s\n",
+                   sampleMode.c_str());
+    }
+    if( registerMode == "eager" ){
+      regMode = RegisterMode::EAGER;
+    }else if( registerMode == "lazy" ){
+      regMode = RegisterMode::LAZY;
+    }else if( registerMode == "vector" ){
+      regMode = RegisterMode::VECTOR;
+    }else{
+      output.fatal(CALL_INFO, -1, "Error: unknown registerMode: %s\n",
+                   registerMode.c_str());
+    }
+    if( sampling && numStats == 0 )
+      output.fatal(CALL_INFO, -1, "Error: sampleMode requires at least one statistic\n");
+
+    localRNG = new SST::RNG::MersenneRNG(uint32_t(id) + rngSeed);
 
     // initialize the statistics
-    for( auto i = 0x00ull; i<numStats; i++ ){
-      std::string sName = std::to_string(i);
-      VStat.push_back(registerStatistic<uint64_t>("STAT_", sName));
+    auto start = std::chrono::steady_clock::now();
+    switch( regMode ){
+    case RegisterMode::EAGER:
+      for( auto i = 0x00ull; i<numStats; i++ ){
+        std::string sName = std::to_string(i);
+        VStat.push_back(registerStatistic<uint64_t>("STAT_", sName));
+      }
+      numRegistered = numStats;
+      break;
+    case RegisterMode::LAZY:
+      VStat.resize(numStats, nullptr);
+      break;
+    case RegisterMode::VECTOR:
+      VecStat = registerStatistic<uint64_t>("STAT_VEC");
+      numRegistered = 1;
+      break;
     }
+    registerNs += (uint64_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
   }
 
   LargeStat::~LargeStat(){
+    delete localRNG;
   }
 
   void LargeStat::setup(){
+    if( regMode == RegisterMode::LAZY && sampling ){
+      auto start = std::chrono::steady_clock::now();
+      registerPlannedStats();
+      registerNs += (uint64_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start).count());
+    }
+  }
+
+  void LargeStat::registerPlannedStats(){
+    // The core does not permit statistic registration once the simulation
+    // has started, so first use is determined by replaying the sampling plan.
+    switch( mode ){
+    case SampleMode::ALL:
+      for( uint64_t i = 0; i<numStats; i++ )
+        registerStat(i);
+      break;
+    case SampleMode::RANDOM:{
+      // identically seeded so the replay draws the same sequence
+      SST::RNG::MersenneRNG planRNG(uint32_t(getId()) + rngSeed);
+      for( uint64_t i = 0; i<numClocks * samplesPerTick; i++ ){
+        uint64_t idx = planRNG.generateNextUInt64() % numStats;
+        if( VStat[idx] == nullptr )
+          registerStat(idx);
+      }
+      break;
+    }
+    case SampleMode::ROUNDROBIN:{
+      uint64_t n = std::min(numStats, numClocks * samplesPerTick);
+      for( uint64_t i = 0; i<n; i++ )
+        registerStat(i);
+      break;
+    }
+    }
   }
 
   void LargeStat::finish(){
+    output.verbose( CALL_INFO, 1, 0,
+                    "registered=%" PRIu64 " registerNs=%" PRIu64 "\n",
+                    numRegistered, registerNs );
+    if( sampling ){
+      output.verbose( CALL_INFO, 1, 0,
+                      "samples=%" PRIu64 " sampleNs=%" PRIu64 " nsPerSample=%.3f\n",
+                      numSamples, sampleNs,
+                      numSamples ? (double)(sampleNs) / (double)(numSamples) : 0. );
+    }
+    if( dumpPeriod > 0 ){
+      output.verbose( CALL_INFO, 1, 0,
+                      "rank=%" PRIu32 " dumps=%" PRIu64 " dumpNs=%" PRIu64 " nsPerDump=%.3f\n",
+                      getRank().rank, numDumps, dumpNs,
+                      numDumps ? (double)(dumpNs) / (double)(numDumps) : 0. );
+    }
+  }
+
+  void LargeStat::dumpStats(){
+    auto start = std::chrono::steady_clock::now();
+    for( auto* stat : VStat ){
+      // statistics that are not enabled or not yet registered have no output
+      if( stat != nullptr && !stat->isNullStatistic() )
+        performStatisticOutput(stat);
+    }
+    if( VecStat != nullptr && !VecStat->isNullStatistic() )
+      performStatisticOutput(VecStat);
+    dumpNs += (uint64_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+    numDumps++;
   }
 
   void LargeStat::init( unsigned int phase ){
   }
 
   bool LargeStat::clockTick( SST::Cycle_t currentCycle ){
-    primaryComponentOKToEndSim();
-    return true;
+    if( sampling ){
+      const uint64_t value = (uint64_t)(currentCycle) % valueRange;
+      // draw the random indices outside the timed region so nsPerSample
+      // measures addData alone, as in the other modes
+      if( mode == SampleMode::RANDOM ){
+        randIdx.resize(samplesPerTick);
+        for( uint64_t i = 0; i<samplesPerTick; i++ )
+          randIdx[i] = localRNG->generateNextUInt64() % numStats;
+      }
+      auto start = std::chrono::steady_clock::now();
+      switch( mode ){
+      case SampleMode::ALL:
+        for( uint64_t i = 0; i<numStats; i++ )
+          sample(i, value);
+        break;
+      case SampleMode::RANDOM:
+        for( uint64_t i = 0; i<samplesPerTick; i++ )
+          sample(randIdx[i], value);
+        break;
+      case SampleMode::ROUNDROBIN:
+        for( uint64_t i = 0; i<samplesPerTick; i++ ){
+          sample(rrIndex, value);
+          rrIndex = (rrIndex + 1) % numStats;
+        }
+        break;
+      }
+      sampleNs += (uint64_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+    }
+
+    if( dumpPeriod > 0 && ((uint64_t)(currentCycle) % dumpPeriod) == 0 )
+      dumpStats();
+
+    if( (uint64_t)(currentCycle) >= numClocks ){
+      primaryComponentOKToEndSim();
+      return true;
+    }
+    return false;
   }
 }
 
@@ -13,11 +13,13 @@
 
 // clang-format off
 // -- Standard Headers
+#include <algorithm>
+#include <chrono>
 #include <vector>
 #include <queue>
 #include <stdio.h>
 #include <stdlib.h>
-// #include <inttypes.h>
+#include <inttypes.h>
 #include <time.h>
 
 // -- SST Headers
@@ -33,7 +35,6 @@ namespace SST::LargeStat{
 // statistics, we need to update this microbenchmark
 // to checkpoint all the stats.
 // - add checkpoint/restore support
-// - modify the clock function to support longer runtimes
 // -------------------------------------------------------
 
 // -------------------------------------------------------
@@ -41,6 +42,20 @@ namespace SST::LargeStat{
 // -------------------------------------------------------
 class LargeStat : public SST::Component{
 public:
+  /// LargeStat: statistic sampling modes
+  enum class SampleMode : uint32_t {
+    ALL        = 0,     ///< every statistic receives a sample each tick
+    RANDOM     = 1,     ///< samplesPerTick randomly selected statistics
+    ROUNDROBIN = 2,     ///< samplesPerTick statistics in round-robin order
+  };
+
+  /// LargeStat: statistic registration modes
+  enum class RegisterMode : uint32_t {
+    EAGER  = 0,         ///< register every statistic in the constructor
+    LAZY   = 1,         ///< register in setup only the statistics the sampling plan uses
+    VECTOR = 2,         ///< register a single statistic that records stat numbers, not values
+  };
+
   /// LargeStat: top-level SST component constructor
   LargeStat( SST::ComponentId_t id, const SST::Params& params );
 
@@ -73,6 +88,13 @@ public:
   SST_ELI_DOCUMENT_PARAMS(
     {"verbose",         "Sets the verbosity level of output",   "0" },
     {"numStats",        "Sets the number of stats to create",   "1" },
+    {"numClocks",       "Sets the number of clock cycles to execute", "1" },
+    {"sampleMode",      "Sets the statistics sampled each tick: none|all|random|roundrobin", "none" },
+    {"samplesPerTick",  "Sets the number of samples per tick (random, roundrobin)", "1" },
+    {"valueRange",      "Sets the range of sampled values [0,valueRange)", "1024" },
+    {"rngSeed",         "Sets the RNG seed",                    "31337" },
+    {"dumpPeriod",      "Sets the number of cycles between statistic dumps (0 disables)", "0" },
+    {"registerMode",    "Sets the statistic registration mode: eager|lazy (planned stats, in setup)|vector (records stat numbers, not values)", "eager" },
   )
 
   // -------------------------------------------------------
@@ -85,6 +107,7 @@ public:
   // -------------------------------------------------------
   SST_ELI_DOCUMENT_STATISTICS(
     {"STAT_", "Basic stat handler", "count", 1},
+    {"STAT_VEC", "Single statistic receiving the stat number, not the value, of each sample (vector mode)", "index", 1},
   )
 
 private:
@@ -94,8 +117,51 @@ private:
   SST::Clock::HandlerBase* clockHandler;          ///< Clock Handler
 
   uint64_t numStats;                              ///< Number of stats to create
+  uint64_t numClocks;                             ///< Number of clock cycles to run
+  bool sampling;                                  ///< Sampling is enabled
+  SampleMode mode;                                ///< Statistic sampling mode
+  uint64_t samplesPerTick;                        ///< Samples per tick (random, roundrobin)
+  uint64_t valueRange;                            ///< Range of sampled values
+  uint64_t rrIndex;                               ///< Next round-robin statistic
+  uint64_t numSamples;                            ///< Total number of addData calls
+  uint64_t sampleNs;                              ///< Wall clock ns spent in addData
+  uint64_t dumpPeriod;                            ///< Cycles between statistic dumps
+  uint64_t numDumps;                              ///< Number of statistic dumps
+  uint64_t dumpNs;                                ///< Wall clock ns spent in dumps
+  RegisterMode regMode;                           ///< Statistic registration mode
+  uint32_t rngSeed;                               ///< RNG seed
+  uint64_t numRegistered;                         ///< Number of registered statistics
+  uint64_t registerNs;                            ///< Wall clock ns spent registering
+
+  SST::RNG::Random* localRNG;                     ///< Random number generator
 
   std::vector<Statistic<uint64_t>*> VStat;        ///< Statistics vector
+  std::vector<uint64_t> randIdx;                  ///< Random mode indices of the current tick
+  Statistic<uint64_t>* VecStat;                   ///< Vector mode statistic
+
+  /// LargeStat: output all of this component's statistics
+  void dumpStats();
+
+  /// LargeStat: register statistic idx
+  void registerStat( uint64_t idx ){
+    VStat[idx] = registerStatistic<uint64_t>("STAT_", std::to_string(idx));
+    numRegistered++;
+  }
+
+  /// LargeStat: register the statistics the sampling plan will use
+  void registerPlannedStats();
+
+  /// LargeStat: add a single sample to statistic idx
+  void sample( uint64_t idx, uint64_t value ){
+    if( regMode == RegisterMode::VECTOR ){
+      VecStat->addData(idx);
+    }else{
+      if( VStat[idx] == nullptr )
+        registerStat(idx);
+      VStat[idx]->addData(value);
+    }
+    numSamples++;
+  }
 
 };  // class LargeStat
 }   // namespace SST::LargeStat
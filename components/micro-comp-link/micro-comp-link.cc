@@ -71,7 +71,10 @@ namespace SST::MicroCompLink{
         output.verbose(CALL_INFO, 10, 0,
                        "Broadcasting endpoint id=%" PRIu64 "\n",
                        id);
-        dummy.push_back( (uint8_t)(id&0b11111111) );
+        // encode every byte so endpoint ids above 255 survive discovery
+        for( unsigned i=0; i<sizeof(uint64_t); i++ ){
+          dummy.push_back( (uint8_t)((id >> (i*8))&0b11111111) );
+        }
 
         nicEvent *ev = new nicEvent(dummy);
         SST::Interfaces::SimpleNetwork::Request* req =
@@ -222,6 +225,9 @@ namespace SST::MicroCompLink{
   }
 
   void MicroCompLink::finish(){
+    output.verbose( CALL_INFO, 1, 0, "address=%" PRIu64 " endpoints=%u next=%" PRIu64 "\n",
+                    (uint64_t)(Nic->getAddress()), Nic->getNumDestinations(),
+                    Nic->getNextAddress() );
   }
 
   void MicroCompLink::init( unsigned int phase ){
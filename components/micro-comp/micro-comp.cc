@@ -16,16 +16,75 @@ namespace SST::MicroComp{
   // MicroComp
   //------------------------------------------
   MicroComp::MicroComp(SST::ComponentId_t id, const SST::Params& params ) :
-    SST::Component( id ), clockHandler(nullptr) {
+    SST::Component( id ), resumeLink(nullptr), workSink(0), activeClocks(0) {
     const uint32_t Verbosity = params.find< uint32_t >( "verbose", 0 );
     output.init(
       "MicroComp[" + getName() + ":@p:@t]: ",
       Verbosity, 0, SST::Output::STDOUT );
-    output.verbose( CALL_INFO, 5, 0, "Init is complete\n" );
-    clockHandler  = new SST_CLOCK_HANDLER<MicroComp, &MicroComp::clockTick>(this);
-    timeConverter = registerClock("1GHz", clockHandler);
+
+    numCycles       = params.find< uint64_t >( "numCycles", 1 );
+    workNs          = params.find< uint64_t >( "workNs", 0 );
+    suspendInterval = params.find< uint64_t >( "suspendInterval", 0 );
+    suspendCycles   = params.find< uint64_t >( "suspendCycles", 10 );
+    const uint32_t numClocks = params.find< uint32_t >( "numClocks", 1 );
+    const uint64_t workBytes = params.find< uint64_t >( "workBytes", 0 );
+    const std::string clockFreq = params.find< std::string >( "clockFreq", "1GHz" );
+
+    if( numCycles == 0 )
+      output.fatal(CALL_INFO, -1, "Error: numCycles must be at least 1\n");
+    if( numClocks == 0 )
+      output.fatal(CALL_INFO, -1, "Error: numClocks must be at least 1\n");
+    if( suspendInterval > 0 && suspendCycles == 0 )
+      output.fatal(CALL_INFO, -1, "Error: suspendCycles must be at least 1\n");
+
+    UnitAlgebra basePeriod(clockFreq);
+    if( basePeriod.hasUnits("Hz") )
+      basePeriod = basePeriod.invert();
+    else if( !basePeriod.hasUnits("s") )
+      output.fatal(CALL_INFO, -1, "Error: clockFreq must have units of Hz or s: %s\n",
+                   clockFreq.c_str());
+
+    // domain N runs at 1/(N+1) of the base frequency
+    for( uint32_t d = 0; d < numClocks; d++ ){
+      UnitAlgebra period = basePeriod;
+      period *= (d+1);
+      clockHandlers.push_back(
+        new SST_CLOCK_HANDLER<MicroComp, &MicroComp::clockTick, uint32_t>(this, d));
+      timeConverters.push_back(registerClock(period, clockHandlers[d]));
+    }
+    domainTicks.resize(numClocks, 0);
+    activeClocks = numClocks;
+
+    if( suspendInterval > 0 ){
+      resumeLink = configureSelfLink("resume", basePeriod,
+                                     new SST_EVENT_HANDLER<MicroComp,
+                                     &MicroComp::handleResume>(this));
+    }
+
+    // one word per 64 byte line is touched on each tick
+    workBuf.resize(workBytes / sizeof(uint64_t), 0);
+
+    // footprint: touched state, ports and statistics
+    const uint64_t stateBytes = params.find< uint64_t >( "stateBytes", 0 );
+    const uint64_t numPorts = params.find< uint64_t >( "numPorts", 0 );
+    const uint64_t numStats = params.find< uint64_t >( "numStats", 0 );
+    state.resize(stateBytes);
+    for( size_t i = 0; i < state.size(); i += 4096 )
+      state[i] = (uint8_t)(i >> 12);
+    for( uint64_t i = 0; i < numPorts; i++ ){
+      SST::Link* l = configureLink("port" + std::to_string(i),
+                                   new SST_EVENT_HANDLER<MicroComp,
+                                   &MicroComp::handleEvent>(this));
+      if( l == nullptr )
+        output.fatal(CALL_INFO, -1, "Error: port%" PRIu64 " is not connected\n", i);
+      links.push_back(l);
+    }
+    for( uint64_t i = 0; i < numStats; i++ )
+      stats.push_back(registerStatistic<uint64_t>("STAT_", std::to_string(i)));
+
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
+    output.verbose( CALL_INFO, 5, 0, "Init is complete\n" );
   }
 
   MicroComp::~MicroComp(){
@@ -35,14 +94,59 @@ namespace SST::MicroComp{
   }
 
   void MicroComp::finish(){
+    uint64_t ticks = 0;
+    for( auto t : domainTicks )
+      ticks += t;
+    output.verbose( CALL_INFO, 1, 0,
+                    "ticks=%" PRIu64 " workSink=%" PRIu64 " stateBytes=%zu links=%zu stats=%zu\n",
+                    ticks, workSink, state.size(), links.size(), stats.size() );
   }
 
   void MicroComp::init( unsigned int phase ){
   }
 
-  bool MicroComp::clockTick( SST::Cycle_t currentCycle ){
-    primaryComponentOKToEndSim();
-    return true;
+  void MicroComp::doWork(){
+    if( workNs > 0 ){
+      auto start = std::chrono::steady_clock::now();
+      auto limit = std::chrono::nanoseconds(workNs);
+      while( std::chrono::steady_clock::now() - start < limit ){
+        workSink++;
+      }
+    }
+    for( size_t i = 0; i < workBuf.size(); i += 8 ){
+      workBuf[i]++;
+      workSink += workBuf[i];
+    }
+  }
+
+  bool MicroComp::clockTick( SST::Cycle_t currentCycle, uint32_t domain ){
+    doWork();
+    domainTicks[domain]++;
+
+    if( domainTicks[domain] >= numCycles ){
+      activeClocks--;
+      if( activeClocks == 0 )
+        primaryComponentOKToEndSim();
+      return true;
+    }
+
+    // periodically remove this clock and re-register it after suspendCycles
+    if( suspendInterval > 0 && (domainTicks[domain] % suspendInterval) == 0 ){
+      resumeLink->send(suspendCycles * (domain+1), new MicroCompResumeEvent(domain));
+      return true;
+    }
+    return false;
+  }
+
+  void MicroComp::handleEvent( SST::Event* ev ){
+    delete ev;
+  }
+
+  void MicroComp::handleResume( SST::Event* ev ){
+    MicroCompResumeEvent* re = static_cast<MicroCompResumeEvent*>(ev);
+    uint32_t d = re->getDomain();
+    reregisterClock(timeConverters[d], clockHandlers[d]);
+    delete ev;
   }
 
 }
@@ -13,11 +13,12 @@
 
 // clang-format off
 // -- Standard Headers
+#include <chrono>
 #include <vector>
 #include <queue>
 #include <stdio.h>
 #include <stdlib.h>
-// #include <inttypes.h>
+#include <inttypes.h>
 #include <time.h>
 
 // -- SST Headers
@@ -26,6 +27,37 @@
 
 namespace SST::MicroComp{
 
+// -------------------------------------------------------
+// MicroCompResumeEvent
+// -------------------------------------------------------
+class MicroCompResumeEvent : public SST::Event{
+public:
+  /// MicroCompResumeEvent: standard constructor
+  MicroCompResumeEvent() : SST::Event() {}
+
+  /// MicroCompResumeEvent: constructor
+  MicroCompResumeEvent(uint32_t d) : SST::Event(), domain(d) {}
+
+  /// MicroCompResumeEvent: destructor
+  ~MicroCompResumeEvent() {}
+
+  /// MicroCompResumeEvent: retrieve the clock domain to resume
+  uint32_t getDomain() const { return domain; }
+
+private:
+  uint32_t domain = 0;          ///< MicroCompResumeEvent: suspended clock domain
+
+  /// MicroCompResumeEvent: serialization method
+  void serialize_order(SST::Core::Serialization::serializer& ser) override{
+    Event::serialize_order(ser);
+    SST_SER(domain);
+  }
+
+  /// MicroCompResumeEvent: serialization implementor
+  ImplementSerializable(SST::MicroComp::MicroCompResumeEvent);
+
+};  // class MicroCompResumeEvent
+
 // -------------------------------------------------------
 // MicroComp
 // -------------------------------------------------------
@@ -46,8 +78,14 @@ public:
   /// MicroComp: standard SST component init function
   void init( unsigned int phase ) override;
 
-  /// MicroComp: standard SST component clock function
-  bool clockTick( SST::Cycle_t currentCycle );
+  /// MicroComp: standard SST component clock function; one handler per clock domain
+  bool clockTick( SST::Cycle_t currentCycle, uint32_t domain );
+
+  /// MicroComp: resume a suspended clock domain
+  void handleResume( SST::Event* ev );
+
+  /// MicroComp: port event handler; events are discarded
+  void handleEvent( SST::Event* ev );
 
   // -------------------------------------------------------
   // MicroComp Component Registration Data
@@ -62,6 +100,26 @@ public:
 
   SST_ELI_DOCUMENT_PARAMS(
     {"verbose",         "Sets the verbosity level of output",   "0" },
+    {"numCycles",       "Sets the number of cycles each clock domain ticks", "1" },
+    {"numClocks",       "Sets the number of clock domains; domain N runs at clockFreq/(N+1)", "1" },
+    {"clockFreq",       "Sets the frequency of the first clock domain", "1GHz" },
+    {"workNs",          "Sets the wall clock ns of spin work per tick", "0" },
+    {"workBytes",       "Sets the bytes of memory touched per tick (one word per cache line)", "0" },
+    {"suspendInterval", "Sets the number of ticks between clock suspensions (0 disables)", "0" },
+    {"suspendCycles",   "Sets the number of domain cycles a clock remains suspended", "10" },
+    {"stateBytes",      "Sets the bytes of touched per-component state", "0" },
+    {"numPorts",        "Sets the number of ports to configure", "0" },
+    {"numStats",        "Sets the number of statistics to register", "0" },
+  )
+
+  // -------------------------------------------------------
+  // MicroComp Component Port Data
+  // -------------------------------------------------------
+  SST_ELI_DOCUMENT_PORTS(
+    {"port%(numPorts)d",
+      "Ports which connect to endpoints; no events are sent.",
+      {}
+    }
   )
 
   // -------------------------------------------------------
@@ -72,13 +130,36 @@ public:
   // -------------------------------------------------------
   // MicroComp Component Statistics Data
   // -------------------------------------------------------
-  SST_ELI_DOCUMENT_STATISTICS()
+  SST_ELI_DOCUMENT_STATISTICS(
+    {"STAT_", "Per-component footprint statistic", "count", 1},
+  )
 
 private:
   // -- internal handlers
   SST::Output    output;                    ///< SST output handler
-  TimeConverter timeConverter;              ///< SST time conversion handler
-  SST::Clock::HandlerBase* clockHandler ;   ///< Clock Handler
+  std::vector<TimeConverter> timeConverters;              ///< SST time conversion handler per domain
+  std::vector<SST::Clock::HandlerBase*> clockHandlers;    ///< Clock handler per domain
+  SST::Link* resumeLink;                    ///< Self link for clock resumption
+
+  // -- parameters
+  uint64_t numCycles;                       ///< Ticks per clock domain
+  uint64_t workNs;                          ///< Spin work per tick
+  uint64_t suspendInterval;                 ///< Ticks between suspensions
+  uint64_t suspendCycles;                   ///< Cycles per suspension
+
+  // -- internal state
+  std::vector<uint64_t> domainTicks;        ///< Ticks executed per domain
+  std::vector<uint64_t> workBuf;            ///< Memory-touch kernel buffer
+  uint64_t workSink;                        ///< Accumulated kernel result
+  uint32_t activeClocks;                    ///< Domains that have not completed
+
+  // -- footprint state
+  std::vector<uint8_t> state;               ///< Per-component state buffer
+  std::vector<SST::Link*> links;            ///< Configured port links
+  std::vector<Statistic<uint64_t>*> stats;  ///< Registered statistics
+
+  /// MicroComp: execute the synthetic per-tick work
+  void doWork();
 
 };  // class MicroComp
 }   // namespace SST::MicroComp
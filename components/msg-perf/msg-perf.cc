@@ -247,6 +247,9 @@ namespace SST::MsgPerf{
   }
 
   void MsgPerfCPU::finish(){
+    output.verbose( CALL_INFO, 1, 0, "%s %s\n",
+                    getName().c_str(), runDigest.str().c_str() );
+    runDigest.report( output, getRank().rank );
   }
 
   void MsgPerfCPU::init( unsigned int phase ){
@@ -254,6 +257,8 @@ namespace SST::MsgPerf{
   }
 
   void MsgPerfCPU::handleMessage( Event *ev ){
+    nicEvent *nev = static_cast<nicEvent*>(ev);
+    runDigest.add( getCurrentSimTime(), 0, nev->getData() );
     delete ev;
     // TODO: record statistics
     //RecvClock[recvStatPtr]->addData((uint64_t)(currentCycle));
@@ -269,6 +274,7 @@ namespace SST::MsgPerf{
 
     // setup all the statistics
     BitsSent = registerStatistic<uint64_t>("BitsSent");
+    runDigest.registerStat(registerStatistic<uint64_t>("RUN_DIGEST"));
     for( unsigned i=0; i<steps.size(); i++ ){
       for( uint64_t j=0; j<iters; j++ ){
         // step i; iter j statistics
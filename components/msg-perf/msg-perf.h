@@ -22,6 +22,7 @@
 
 // -- SST Headers
 #include "SST.h"
+#include "rundigest.h"
 // clang-format on
 
 
@@ -245,6 +246,7 @@ public:
     {"ByteSize",  "Byte size of payload", "size",   1},
     {"SentClock", "Sent clock cycle",     "cycle",  1},
     {"RecvClock", "Recv clock cycle",     "cycle",  1},
+    RUNDIGEST_ELI_STATISTICS,
   )
 
 private:
@@ -275,6 +277,7 @@ private:
   std::vector<Statistic<uint64_t>*> ByteSize;
   std::vector<Statistic<uint64_t>*> SentClock;
   std::vector<Statistic<uint64_t>*> RecvClock;
+  rundigest::RunDigest runDigest;   ///< digest of received messages
 
   // -- private methods
   /// MsgPerfCPU : setup each simulation step
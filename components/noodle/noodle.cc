@@ -72,9 +72,19 @@ Noodle::Noodle(SST::ComponentId_t id, const SST::Params& params ) :
     portname[i] = "port" + std::to_string(i);
     linkHandlers[i] = configureLink("port"+std::to_string(i),
                                     new Event::Handler2<Noodle,
-                                    &Noodle::handleEvent>(this));
+                                    &Noodle::handleEvent,
+                                    uint64_t>(this, i));
   }
 
+  // register the run digest statistic
+  runDigest.registerStat(registerStatistic<uint64_t>("RUN_DIGEST"));
+
+  // register the thread hardware counter statistics
+  perfStats.registerStats(registerStatistic<uint64_t>("PERF_CYCLES"),
+                          registerStatistic<uint64_t>("PERF_INSTRUCTIONS"),
+                          registerStatistic<uint64_t>("PERF_CACHE_MISSES"),
+                          registerStatistic<uint64_t>("PERF_BRANCH_MISSES"));
+
   // setup the local random number generator
   localRNG = new SST::RNG::MersenneRNG(uint32_t(id) + rngSeed);
 
@@ -87,25 +97,34 @@ Noodle::~Noodle(){
 }
 
 void Noodle::setup(){
+  perfStats.start();
 }
 
 void Noodle::finish(){
+  SCOPEPROF_REPORT(output);
+  perfStats.stop(output);
+  output.verbose(CALL_INFO, 1, 0, "%s %s\n",
+                 getName().c_str(), runDigest.str().c_str());
+  runDigest.report(output, getRank().rank);
 }
 
 void Noodle::init( unsigned int phase ){
 }
 
-void Noodle::handleEvent(SST::Event *ev){
+void Noodle::handleEvent(SST::Event *ev, uint64_t port){
+  SCOPEPROF("Noodle::handleEvent");
   NoodleEvent *ne = static_cast<NoodleEvent*>(ev);
   auto data = ne->getData();
   output.verbose(CALL_INFO, 5, 0,
                  "%s: received %zu bytes\n",
                  getName().c_str(),
                  data.size());
+  runDigest.add(getCurrentSimTime(), port, data);
   delete ev;
 }
 
 void Noodle::sendData(){
+  SCOPEPROF("Noodle::sendData");
   std::vector<uint64_t> sendPorts;
 
   // build a list of ports to send data over, note that there can be duplicates
@@ -138,6 +157,7 @@ void Noodle::sendData(){
 }
 
 bool Noodle::clockTick(SST::Cycle_t currentCycle){
+  SCOPEPROF("Noodle::clockTick");
   if( (uint64_t)(currentCycle) >= clocks ){
     output.verbose(CALL_INFO, 1, 0,
                    "%s is ready to end simulation\n",
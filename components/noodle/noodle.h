@@ -23,6 +23,9 @@
 // clang-format off
 // -- SST Headers
 #include "SST.h"
+#include "rundigest.h"
+#include "scopeprof.h"
+#include "perfstats.h"
 #include <sst/core/rng/distrib.h>
 #include <sst/core/rng/rng.h>
 #include <sst/core/rng/mersenne.h>
@@ -126,7 +129,10 @@ public:
   // -------------------------------------------------------
   // Noodle Component Statistics Data
   // -------------------------------------------------------
-  SST_ELI_DOCUMENT_STATISTICS()
+  SST_ELI_DOCUMENT_STATISTICS(
+    RUNDIGEST_ELI_STATISTICS,
+    PERFSTATS_ELI_STATISTICS
+  )
 
   // -------------------------------------------------------
   // Noodle Component Checkpoint Methods
@@ -137,6 +143,7 @@ public:
   /// Noodle: serialization
   void serialize_order(SST::Core::Serialization::serializer& ser) override {
     SST::Component::serialize_order(ser);
+    SST_SER(output);
     SST_SER(clockHandler);
     SST_SER(numPorts);
     SST_SER(msgsPerClock);
@@ -147,6 +154,8 @@ public:
     SST_SER(portname);
     SST_SER(linkHandlers);
     SST_SER(localRNG);
+    runDigest.serialize_order(ser);
+    perfStats.serialize_order(ser);
   }
 
   /// Noodle: serialization implementations
@@ -170,10 +179,12 @@ private:
   std::vector<std::string> portname;              ///< port 0 to numPorts names
   std::vector<SST::Link *> linkHandlers;          ///< LinkHandler objects
   SST::RNG::Random* localRNG = 0;                 ///< component local random number generator
+  rundigest::RunDigest runDigest;                 ///< digest of received messages
+  perfstats::PerfStats perfStats;                 ///< thread hardware counters
 
   // -- private methods
   /// Noodle: Message Event Handler
-  void handleEvent(SST::Event *ev);
+  void handleEvent(SST::Event *ev, uint64_t port);
 
   /// Noodle: Sends data to an adjacent link
   void sendData();
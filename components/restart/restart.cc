@@ -34,6 +34,12 @@ Restart::Restart(SST::ComponentId_t id, const SST::Params& params ) :
   clocks = params.find<uint64_t>("clocks", 1000);
   baseSeed = params.find<unsigned>("baseSeed", "1223");
 
+  // checkpoint timing statistics
+  cptStats.registerStats(registerStatistic<uint64_t>("CPT_SER_NS"),
+                         registerStatistic<uint64_t>("CPT_SER_BYTES"),
+                         registerStatistic<uint64_t>("CPT_DESER_NS"),
+                         registerStatistic<uint64_t>("CPT_DESER_BYTES"));
+
   // constructor complete
   output.verbose( CALL_INFO, 5, 0, "Constructor complete\n" );
 }
@@ -45,6 +51,8 @@ void Restart::setup(){
 }
 
 void Restart::finish(){
+  cptStats.flush();
+  cptStats.report(output, getRank().rank);
 }
 
 void Restart::init( unsigned int phase ){
@@ -63,15 +71,20 @@ void Restart::printStatus( Output& out ){
 }
 
 void Restart::serialize_order(SST::Core::Serialization::serializer& ser){
+  cptStats.begin(ser);
   SST::Component::serialize_order(ser);
   SST_SER(clockHandler);
   SST_SER(numBytes);
   SST_SER(clocks);
   SST_SER(baseSeed);
   SST_SER(data);
+  cptStats.serialize_order(ser);
+  cptStats.end(ser);
 }
 
 bool Restart::clockTick( SST::Cycle_t currentCycle ){
+  // record the deserialize sample on the first tick after a restart
+  cptStats.flush();
 
   // sanity check the array
   for( uint64_t i = 0; i < (numBytes/4ull); i++ ){
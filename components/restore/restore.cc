@@ -36,6 +36,12 @@ Restore::Restore(SST::ComponentId_t id, const SST::Params& params ) :
   // setup the rng
   mersenne = new SST::RNG::MersenneRNG(params.find<unsigned int>("rngSeed", 1223));
 
+  // checkpoint timing statistics
+  cptStats.registerStats(registerStatistic<uint64_t>("CPT_SER_NS"),
+                         registerStatistic<uint64_t>("CPT_SER_BYTES"),
+                         registerStatistic<uint64_t>("CPT_DESER_NS"),
+                         registerStatistic<uint64_t>("CPT_DESER_BYTES"));
+
   // constructor complete
   output.verbose( CALL_INFO, 5, 0, "Constructor complete\n" );
 }
@@ -47,6 +53,8 @@ void Restore::setup(){
 }
 
 void Restore::finish(){
+  cptStats.flush();
+  cptStats.report(output, getRank().rank);
 }
 
 void Restore::init( unsigned int phase ){
@@ -65,15 +73,20 @@ void Restore::printStatus( Output& out ){
 }
 
 void Restore::serialize_order(SST::Core::Serialization::serializer& ser){
+  cptStats.begin(ser);
   SST::Component::serialize_order(ser);
   SST_SER(clockHandler);
   SST_SER(numBytes);
   SST_SER(clocks);
   SST_SER(mersenne);
   SST_SER(data);
+  cptStats.serialize_order(ser);
+  cptStats.end(ser);
 }
 
 bool Restore::clockTick( SST::Cycle_t currentCycle ){
+  // record the deserialize sample on the first tick after a restart
+  cptStats.flush();
 
   // check to see if we've reached the completion state
   if( (uint64_t)(currentCycle) >= clocks ){
@@ -23,6 +23,7 @@
 
 // -- SST Headers
 #include "SST.h"
+#include "cptstats.h"
 #include <sst/core/rng/distrib.h>
 #include <sst/core/rng/rng.h>
 #include <sst/core/rng/mersenne.h>
@@ -88,7 +89,9 @@ public:
   // -------------------------------------------------------
   // Restore Component Statistics Data
   // -------------------------------------------------------
-  SST_ELI_DOCUMENT_STATISTICS()
+  SST_ELI_DOCUMENT_STATISTICS(
+    CPTSTATS_ELI_STATISTICS
+  )
 
   // -------------------------------------------------------
   // Restore Component Checkpoint Methods
@@ -107,6 +110,7 @@ private:
   SST::Output    output;                          ///< SST output handler
   TimeConverter timeConverter;                    ///< SST time conversion handler
   SST::Clock::HandlerBase* clockHandler;          ///< Clock Handler
+  cptstats::CptStats cptStats;                    ///< checkpoint timing statistics
 
   // -- parameters
   uint64_t numBytes;                              ///< number of bytes to store
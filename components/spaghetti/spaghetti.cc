@@ -17,7 +17,8 @@ namespace SST::Spaghetti{
 //------------------------------------------
 Spaghetti::Spaghetti(SST::ComponentId_t id, const SST::Params& params ) :
   SST::Component( id ), numPorts(2), numMsgs(10), bytesPerMsg(64),
-  rngSeed(31337), numRecv(0), injectedData(false) {
+  rngSeed(31337), reinjectMsgs(0), numRecv(0), numReinjected(0),
+  stopped(false), injectedData(false) {
 
   uint32_t Verbosity = params.find<uint32_t>("verbose", 0);
   output.init(
@@ -33,6 +34,21 @@ Spaghetti::Spaghetti(SST::ComponentId_t id, const SST::Params& params ) :
   numMsgs = params.find<uint64_t>("numMsgs", 10);
   bytesPerMsg = params.find<uint64_t>("bytesPerMsg", 64);
   rngSeed = params.find<uint32_t>("rngSeed", 31337);
+  reinjectMsgs = params.find<uint64_t>("reinjectMsgs", 0);
+  stopTime = params.find<std::string>("stopTime", "");
+
+  // closed-loop mode: a self link fires once at the stop time
+  if( !stopTime.empty() ){
+    UnitAlgebra ua(stopTime);
+    if( !ua.hasUnits("s") ){
+      output.fatal(CALL_INFO, -1,
+                   "%s : stopTime must be specified in units of time: %s\n",
+                   getName().c_str(), stopTime.c_str());
+    }
+    stopLink = configureSelfLink("stopLink", stopTime,
+                                 new Event::Handler2<Spaghetti,
+                                 &Spaghetti::handleStop>(this));
+  }
 
   // setup the port handlers
   portname.resize(numPorts);
@@ -41,17 +57,29 @@ Spaghetti::Spaghetti(SST::ComponentId_t id, const SST::Params& params ) :
     portname[i] = "port" + std::to_string(i);
     linkHandlers[i] = configureLink(portname[i],
                                     new Event::Handler2<Spaghetti,
-                                    &Spaghetti::handleEvent>(this));
+                                    &Spaghetti::handleEvent,
+                                    uint64_t>(this, i));
   }
 
   // setup the local rand number generator
   localRNG = new SST::RNG::MersenneRNG(uint32_t(id) + rngSeed);
 
+  // precompute the legal time bases
+  initTimeBases();
+
   // initialize the statistics
   for( uint64_t i= 0; i<numPorts; i++ ){
     std::string pName = std::to_string(i);
     LStat.push_back(registerStatistic<uint64_t>("LATENCY_PORT_", pName));
+    RStat.push_back(registerStatistic<uint64_t>("RECV_LATENCY_PORT_", pName));
   }
+  runDigest.registerStat(registerStatistic<uint64_t>("RUN_DIGEST"));
+
+  // register the thread hardware counter statistics
+  perfStats.registerStats(registerStatistic<uint64_t>("PERF_CYCLES"),
+                          registerStatistic<uint64_t>("PERF_INSTRUCTIONS"),
+                          registerStatistic<uint64_t>("PERF_CACHE_MISSES"),
+                          registerStatistic<uint64_t>("PERF_BRANCH_MISSES"));
 
   // constructor complete
   output.verbose( CALL_INFO, 5, 0, "Constructor complete\n" );
@@ -62,14 +90,23 @@ Spaghetti::~Spaghetti(){
 }
 
 void Spaghetti::setup(){
+  perfStats.start();
   if( !injectedData ){
     sendData();
     injectedData = true;
+    if( stopLink )
+      stopLink->send(1, new SpaghettiEvent());
   }
   output.verbose( CALL_INFO, 5, 0, "Setup complete\n" );
 }
 
 void Spaghetti::finish(){
+  SCOPEPROF_REPORT( output );
+  perfStats.stop( output );
+  output.verbose( CALL_INFO, 1, 0, "received %" PRIu64 " messages\n", numRecv );
+  output.verbose( CALL_INFO, 1, 0, "%s %s\n",
+                  getName().c_str(), runDigest.str().c_str() );
+  runDigest.report( output, getRank().rank );
   output.verbose( CALL_INFO, 5, 0, "Finish complete\n" );
 }
 
@@ -77,56 +114,102 @@ void Spaghetti::init( unsigned int phase ){
   output.verbose( CALL_INFO, 5, 0, "Init Phase=%d\n", 2 );
 }
 
-void Spaghetti::handleEvent(SST::Event *ev){
+void Spaghetti::handleStop(SST::Event *ev){
+  delete ev;
+  output.verbose( CALL_INFO, 1, 0, "stop time %s reached\n", stopTime.c_str() );
+  stopped = true;
+  primaryComponentOKToEndSim();
+}
+
+void Spaghetti::handleEvent(SST::Event *ev, uint64_t port){
+  SCOPEPROF("Spaghetti::handleEvent");
   SpaghettiEvent *se = static_cast<SpaghettiEvent*>(ev);
   auto data = se->getData();
   output.verbose(CALL_INFO, 5, 0,
                  "%s: received %zu bytes\n",
                  getName().c_str(),
                  data.size());
+  RStat[port]->addData(getCurrentSimTimeNano() - se->getSendTime());
+  runDigest.add(getCurrentSimTime(), port, data);
   delete ev;
 
-  // check for completion status
   numRecv+=1;
+
+  // closed-loop mode: each receipt triggers a new send until the stop time
+  if( stopLink ){
+    if( !stopped )
+      sendMsg(localRNG->generateNextUInt32() % numPorts);
+    return;
+  }
+
+  // re-injection mode: each receipt triggers a new randomized send.
+  // Messages keep circulating so that peers which have not reached
+  // their own quota are never starved.
+  if( reinjectMsgs > 0 ){
+    sendMsg(localRNG->generateNextUInt32() % numPorts);
+    numReinjected+=1;
+    if( numReinjected == reinjectMsgs ){
+      primaryComponentOKToEndSim();
+    }
+    return;
+  }
+
+  // check for completion status
   if( numRecv == (numMsgs*numPorts) ){
     primaryComponentOKToEndSim();
   }
 }
 
+void Spaghetti::initTimeBases(){
+  // time bases are restricted to three bits of precision, aka 7MHz
+  timeBases.clear();
+  for( unsigned freq=1; freq<=7; freq++ ){
+    timeBases.push_back(getTimeConverter(std::to_string(freq) + "MHz"));
+  }
+}
+
 void Spaghetti::sendData(){
+  SCOPEPROF("Spaghetti::sendData");
   output.verbose(CALL_INFO, 5, 0, "sendData()\n");
   for( unsigned i=0; i<numPorts; i++ ){
     for( unsigned j=0; j<numMsgs; j++ ){
-      // build a packet
-      std::vector<uint8_t> packet;
-      packet.resize(bytesPerMsg);
-      for( uint64_t m = 0x00ull; m<bytesPerMsg; m++ ){
-        packet[m] = ((uint8_t)(localRNG->generateNextUInt32() & 0b11111111));
-      }
-
-      // create the packet
-      SpaghettiEvent *se = new SpaghettiEvent(packet);
-
-      // create random time bases and delays using our localRNG
-      // time bases are restricted to three bits of precision, aka 7MHz
-      // delays are restrict to 8 bits of precision. 
-      // 0 MHz is illegal
-      uint32_t freq = localRNG->generateNextUInt32() & 0b111;
-      if (freq==0) freq=1;
-      TimeConverter tc = getTimeConverter(std::to_string(freq) + "MHz");
-      SimTime_t delay = (SimTime_t)(localRNG->generateNextUInt32() & 0b11111111);
-      linkHandlers[i]->send(delay, tc, se);
-      LStat[i]->addData(delay);
-
-      output.verbose(CALL_INFO, 5, 0,
-                     "%s: injected %zu byte message into port = %s\n",
-                     getName().c_str(),
-                     packet.size(),
-                     portname[i].c_str());
+      sendMsg(i);
     }
   }
 }
 
+void Spaghetti::sendMsg(uint64_t port){
+  // the time base table is not serialized; rebuild it after a restart
+  if( timeBases.empty() )
+    initTimeBases();
+
+  // build a packet
+  std::vector<uint8_t> packet;
+  packet.resize(bytesPerMsg);
+  for( uint64_t m = 0x00ull; m<bytesPerMsg; m++ ){
+    packet[m] = ((uint8_t)(localRNG->generateNextUInt32() & 0b11111111));
+  }
+
+  // create the packet
+  SpaghettiEvent *se = new SpaghettiEvent(packet, getCurrentSimTimeNano());
+
+  // create random time bases and delays using our localRNG
+  // time bases are restricted to three bits of precision, aka 7MHz
+  // delays are restrict to 8 bits of precision.
+  // 0 MHz is illegal
+  uint32_t freq = localRNG->generateNextUInt32() & 0b111;
+  if (freq==0) freq=1;
+  SimTime_t delay = (SimTime_t)(localRNG->generateNextUInt32() & 0b11111111);
+  linkHandlers[port]->send(delay, timeBases[freq-1], se);
+  LStat[port]->addData(delay);
+
+  output.verbose(CALL_INFO, 5, 0,
+                 "%s: injected %zu byte message into port = %s\n",
+                 getName().c_str(),
+                 packet.size(),
+                 portname[port].c_str());
+}
+
 } // namespace SST::Spaghetti
 
 // EOF
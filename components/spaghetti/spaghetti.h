@@ -23,6 +23,9 @@
 // clang-format off
 // -- SST Headers
 #include "SST.h"
+#include "rundigest.h"
+#include "scopeprof.h"
+#include "perfstats.h"
 #include <sst/core/rng/distrib.h>
 #include <sst/core/rng/rng.h>
 #include <sst/core/rng/mersenne.h>
@@ -41,19 +44,27 @@ public:
   /// SpaghettiEvent: constructor
   SpaghettiEvent(std::vector<uint8_t> d) : SST::Event(), data(d) {}
 
+  /// SpaghettiEvent: constructor with send time stamp
+  SpaghettiEvent(std::vector<uint8_t> d, SimTime_t t) : SST::Event(), data(d), sendTime(t) {}
+
   /// SpaghettiEvent: destructor
   ~SpaghettiEvent() {}
 
   /// SpaghettiEvent: retrieve the data
   std::vector<uint8_t> const getData() { return data; }
 
+  /// SpaghettiEvent: retrieve the send time stamp (ns)
+  SimTime_t getSendTime() const { return sendTime; }
+
 private:
   std::vector<uint8_t>  data;   ///< SpaghettiEvent: data payload
+  SimTime_t sendTime = 0;       ///< SpaghettiEvent: simulated send time (ns)
 
   /// SpaghettiEvent: serialization method
   void serialize_order(SST::Core::Serialization::serializer& ser) override{
     Event::serialize_order(ser);
     SST_SER(data);
+    SST_SER(sendTime);
   }
 
   /// SpaghettiEvent: serialization implementor
@@ -99,6 +110,8 @@ public:
     {"numMsgs",             "Sets the number of messages per port to inject", "10"},
     {"bytesPerMsg",         "Sets the number of bytes per msg",               "64"},
     {"rngSeed",             "Sets the RNG seed",                              "31337"},
+    {"reinjectMsgs",        "Sets the number of messages re-injected on receipt (0 disables)", "0"},
+    {"stopTime",            "Closed-loop mode: re-inject on every receipt until this simulated time (empty disables)", ""},
   )
 
   // -------------------------------------------------------
@@ -120,7 +133,10 @@ public:
   // Spaghetti Component Statistics Data
   // -------------------------------------------------------
   SST_ELI_DOCUMENT_STATISTICS(
-    {"LATENCY_PORT_", "Histogram of latency values", "latency", 1},
+    {"LATENCY_PORT_", "Histogram of requested injection delays", "latency", 1},
+    {"RECV_LATENCY_PORT_", "Histogram of observed latency at receipt", "ns", 1},
+    RUNDIGEST_ELI_STATISTICS,
+    PERFSTATS_ELI_STATISTICS,
   )
 
   // -------------------------------------------------------
@@ -132,15 +148,24 @@ public:
   /// Spaghetti serialization
   void serialize_order(SST::Core::Serialization::serializer& ser) override {
     SST::Component::serialize_order(ser);
+    SST_SER(output);
     SST_SER(numPorts);
     SST_SER(numMsgs);
     SST_SER(bytesPerMsg);
     SST_SER(rngSeed);
+    SST_SER(reinjectMsgs);
     SST_SER(numRecv);
+    SST_SER(numReinjected);
+    SST_SER(stopTime);
+    SST_SER(stopped);
+    SST_SER(stopLink);
     SST_SER(portname);
     SST_SER(linkHandlers);
     SST_SER(localRNG);
     SST_SER(LStat);
+    SST_SER(RStat);
+    runDigest.serialize_order(ser);
+    perfStats.serialize_order(ser);
   }
 
   /// Spaghetti: serialization implementations
@@ -155,23 +180,41 @@ private:
   uint64_t numMsgs;                               ///< number of messages per clock
   uint64_t bytesPerMsg;                           ///< number of bytes per clock
   uint32_t rngSeed;                               ///< rng seed
+  uint64_t reinjectMsgs;                          ///< number of messages to re-inject on receipt
+  std::string stopTime;                           ///< closed-loop stop time
 
   // -- internal state
   uint64_t numRecv;                               ///< number of messages received
+  uint64_t numReinjected;                         ///< number of messages re-injected
+  bool stopped;                                   ///< closed-loop stop time has been reached
+  SST::Link* stopLink = nullptr;                  ///< self link that fires at stopTime
   bool injectedData;                              ///< determines whether the messages have been sent
   std::vector<std::string> portname;              ///< port 0 to numPorts names
   std::vector<SST::Link *> linkHandlers;          ///< LinkHandler objects
   SST::RNG::Random* localRNG = 0;                 ///< component local random number generator
+  std::vector<TimeConverter> timeBases;           ///< 1MHz-7MHz time converters, indexed by freq-1
 
   std::vector<Statistic<uint64_t>*> LStat;        ///< Statistics vector.  One entry per port.  Histogram of injection latencies
+  std::vector<Statistic<uint64_t>*> RStat;        ///< Statistics vector.  One entry per port.  Histogram of observed latencies
+  rundigest::RunDigest runDigest;                 ///< digest of received messages
+  perfstats::PerfStats perfStats;                 ///< thread hardware counters
 
   // -- private methods
   /// Spaghetti: Message Event Handler
-  void handleEvent(SST::Event *ev);
+  void handleEvent(SST::Event *ev, uint64_t port);
+
+  /// Spaghetti: Closed-loop stop time handler
+  void handleStop(SST::Event *ev);
 
-  /// Spaghetti: Sends data to an adjacent link
+  /// Spaghetti: Sends the initial injection to all adjacent links
   void sendData();
 
+  /// Spaghetti: Sends a single randomized message on the target port
+  void sendMsg(uint64_t port);
+
+  /// Spaghetti: Builds the time converter table
+  void initTimeBases();
+
 };
 
 } // namespace SST::Spaghetti
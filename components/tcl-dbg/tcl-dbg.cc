@@ -37,6 +37,42 @@ TclDbg::TclDbg(SST::ComponentId_t id, const SST::Params& params ) :
   clockDelay = params.find<uint64_t>("clockDelay", 1);
   clocks = params.find<uint64_t>("clocks", 1000);
 
+  const std::string mode = params.find<std::string>("dumpMode", "sync");
+  if( mode == "sync" ){
+    dumpMode = DumpMode::Sync;
+  }else if( mode == "async" ){
+    dumpMode = DumpMode::Async;
+  }else if( mode == "mmap" ){
+    dumpMode = DumpMode::Mmap;
+  }else if( mode == "delta" ){
+    dumpMode = DumpMode::Delta;
+  }else{
+    output.fatal(CALL_INFO, -1,
+                 "%s : unknown dumpMode=%s\n",
+                 getName().c_str(), mode.c_str());
+  }
+
+  updateWords = params.find<uint64_t>("updateWords", 0);
+  deltaChunk = params.find<uint64_t>("deltaChunk", 256);
+  keyframeInterval = params.find<uint64_t>("keyframeInterval", 16);
+  dumpPeriod = params.find<uint64_t>("dumpPeriod", 0);
+
+  const std::string file = params.find<std::string>("dumpFile", "component");
+  if( file == "component" ){
+    rankFile = false;
+  }else if( file == "rank" ){
+    rankFile = true;
+  }else{
+    output.fatal(CALL_INFO, -1,
+                 "%s : unknown dumpFile=%s\n",
+                 getName().c_str(), file.c_str());
+  }
+  if( deltaChunk == 0 ){
+    output.fatal(CALL_INFO, -1,
+                 "%s : deltaChunk must be > 0\n",
+                 getName().c_str());
+  }
+
   // sanity check the params
   if( maxData < minData ){
     output.fatal(CALL_INFO, -1,
@@ -50,6 +86,7 @@ TclDbg::TclDbg(SST::ComponentId_t id, const SST::Params& params ) :
   // register the statistics
   statBytes   = registerStatistic<uint64_t>("statBytes");
   statTiming  = registerStatistic<uint64_t>("statTiming");
+  statLockWait = registerStatistic<uint64_t>("statLockWait");
 
   // setup the debugging object
   Dbg = new SSTDebug(getName(),"./");
@@ -64,6 +101,8 @@ TclDbg::TclDbg(SST::ComponentId_t id, const SST::Params& params ) :
 }
 
 TclDbg::~TclDbg(){
+  stopWriter();
+  closeMap();
   delete Dbg;
 }
 
@@ -71,6 +110,14 @@ void TclDbg::setup(){
 }
 
 void TclDbg::finish(){
+  stopWriter();
+  closeMap();
+  if( dumpFailures > 0 ){
+    output.output("%s : %" PRIu64 " async debug dumps failed\n",
+                  getName().c_str(), (uint64_t)(dumpFailures));
+  }
+  output.verbose(CALL_INFO, 1, 0, "%s : %" PRIu64 " dumps written\n",
+                 getName().c_str(), (uint64_t)(dumpsWritten));
 }
 
 void TclDbg::init( unsigned int phase ){
@@ -78,15 +125,353 @@ void TclDbg::init( unsigned int phase ){
 
 void TclDbg::printStatus( Output& out ){
   auto start = std::chrono::high_resolution_clock::now();
-  if( !Dbg->dump(getCurrentSimCycle(),
-            DARG((uint64_t)(getCurrentSimCycle())),
-            DARG(data)) ){
+  const uint64_t cycle = (uint64_t)(getCurrentSimCycle());
+  uint64_t bytes = (uint64_t)(data.size()*4);
+  bool rtn = true;
+  switch( dumpMode ){
+  case DumpMode::Async:
+    dumpAsync(cycle);
+    break;
+  case DumpMode::Mmap:
+    rtn = dumpMmap(cycle);
+    break;
+  case DumpMode::Delta:
+    rtn = dumpDelta(cycle, bytes);
+    break;
+  default:
+    rtn = dumpData(cycle, data);
+    break;
+  }
+  if( !rtn ){
     out.output("!!!!!!!!!!!!!!!!!!!!!! DEBUG DUMP FAILED !!!!!!!!!!!!!!!!!!!!!!\n");
+  }else if( dumpMode != DumpMode::Async ){
+    // async dumps are counted by the writer once written
+    dumpsWritten++;
   }
   auto stop = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stop-start);
   statTiming->addData((uint64_t)(duration.count()));
-  statBytes->addData((uint64_t)(data.size()*4));
+  statBytes->addData(bytes);
+}
+
+bool TclDbg::dumpData(uint64_t cycle, const std::vector<unsigned>& data){
+  // `data` shadows the member so the dump labels match across modes
+  return Dbg->dump(cycle, DARG(cycle), DARG(data));
+}
+
+void TclDbg::dumpAsync(uint64_t cycle){
+  std::unique_lock<std::mutex> lock(dumpMutex);
+  if( !writer.joinable() ){
+    writerStop = false;
+    writer = std::thread(&TclDbg::writerLoop, this);
+  }
+
+  // the writer owns one buffer; block only while the other still holds
+  // an unconsumed snapshot
+  dumpCV.wait(lock, [this]{ return !snapValid; });
+  snapBuf.assign(data.begin(), data.end());
+  snapCycle = cycle;
+  snapValid = true;
+  lock.unlock();
+  dumpCV.notify_all();
+}
+
+void TclDbg::writerLoop(){
+  std::vector<unsigned> buf;
+  std::unique_lock<std::mutex> lock(dumpMutex);
+  while( true ){
+    dumpCV.wait(lock, [this]{ return snapValid || writerStop; });
+    if( !snapValid ){
+      break;
+    }
+    std::swap(buf, snapBuf);
+    const uint64_t cycle = snapCycle;
+    snapValid = false;
+    lock.unlock();
+    dumpCV.notify_all();
+    if( !dumpData(cycle, buf) ){
+      dumpFailures++;
+    }else{
+      dumpsWritten++;
+    }
+    lock.lock();
+  }
+}
+
+void TclDbg::stopWriter(){
+  if( !writer.joinable() ){
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(dumpMutex);
+    writerStop = true;
+  }
+  dumpCV.notify_all();
+  writer.join();
+}
+
+//------------------------------------------
+// DumpMap
+//------------------------------------------
+DumpMap::~DumpMap(){
+  close();
+}
+
+uint8_t *DumpMap::append(size_t bytes){
+  if( !reserve(used + bytes) ){
+    return nullptr;
+  }
+  uint8_t *p = base + used;
+  used += bytes;
+  return p;
+}
+
+bool DumpMap::reserve(size_t need){
+  if( need <= size ){
+    return true;
+  }
+  if( fd < 0 ){
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if( fd < 0 ){
+      return false;
+    }
+  }
+
+  // grow geometrically in whole pages
+  const size_t page = (size_t)(sysconf(_SC_PAGESIZE));
+  size_t newSize = std::max(need, size * 2);
+  newSize = (newSize + page - 1) / page * page;
+  if( ftruncate(fd, (off_t)(newSize)) != 0 ){
+    return false;
+  }
+  if( base ){
+    munmap(base, size);
+    base = nullptr;
+    size = 0;
+  }
+  void *p = mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if( p == MAP_FAILED ){
+    return false;
+  }
+  base = static_cast<uint8_t *>(p);
+  size = newSize;
+  return true;
+}
+
+bool DumpMap::resume(uint64_t cycle){
+  fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if( fd < 0 ){
+    return false;
+  }
+  struct stat st;
+  if( fstat(fd, &st) != 0 ){
+    return false;
+  }
+  if( st.st_size == 0 ){
+    return true;
+  }
+  void *p = mmap(nullptr, (size_t)(st.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if( p == MAP_FAILED ){
+    return false;
+  }
+  base = static_cast<uint8_t *>(p);
+  size = (size_t)(st.st_size);
+
+  // walk the complete records; later records and any padding left by an
+  // unfinished run are overwritten by the appends of this run
+  used = 0;
+  while( used + sizeof(DumpHeader) <= size ){
+    DumpHeader hdr;
+    std::memcpy(&hdr, base + used, sizeof(DumpHeader));
+    if( hdr.magic != DUMP_MAGIC || hdr.cycle >= cycle ){
+      break;
+    }
+    size_t end = used + sizeof(DumpHeader);
+    if( hdr.kind == DUMP_FULL ){
+      end += hdr.count * sizeof(unsigned);
+    }else{
+      uint64_t nranges = 0;
+      if( end + sizeof(uint64_t) <= size ){
+        std::memcpy(&nranges, base + end, sizeof(uint64_t));
+      }
+      end += sizeof(uint64_t);
+      for( uint64_t r = 0; r < nranges && end <= size; r++ ){
+        uint64_t len = 0;
+        if( end + 2 * sizeof(uint64_t) <= size ){
+          std::memcpy(&len, base + end + sizeof(uint64_t), sizeof(uint64_t));
+        }
+        end += 2 * sizeof(uint64_t) + len * sizeof(unsigned);
+      }
+    }
+    if( end > size ){
+      break;
+    }
+    used = end;
+  }
+  return true;
+}
+
+bool DumpMap::close(){
+  bool rtn = true;
+  if( base ){
+    munmap(base, size);
+    base = nullptr;
+    size = 0;
+  }
+  if( fd >= 0 ){
+    rtn = (ftruncate(fd, (off_t)(used)) == 0);
+    ::close(fd);
+    fd = -1;
+  }
+  return rtn;
+}
+
+// per-rank dump file shared by every TclDbg with dumpFile=rank
+static std::mutex RankMapLock;
+static DumpMap *RankMap = nullptr;
+static unsigned RankMapRefs = 0;
+
+//------------------------------------------
+// TclDbg mapped dumps
+//------------------------------------------
+void TclDbg::openMap(){
+  if( dumpMap ){
+    return;
+  }
+  bool rtn = true;
+  if( !rankFile ){
+    dumpMap = new DumpMap("./" + getName() + ".tdbg");
+    if( restored ){
+      rtn = dumpMap->resume((uint64_t)(getCurrentSimCycle()));
+    }
+  }else{
+    std::lock_guard<std::mutex> lock(RankMapLock);
+    if( !RankMap ){
+      RankMap = new DumpMap("./tcldbg-rank" + std::to_string(getRank().rank) + ".tdbg");
+      if( restored ){
+        rtn = RankMap->resume((uint64_t)(getCurrentSimCycle()));
+      }
+    }
+    RankMapRefs++;
+    dumpMap = RankMap;
+  }
+  if( !rtn ){
+    output.output("%s : failed to resume the dump file\n",
+                  getName().c_str());
+  }
+}
+
+void TclDbg::closeMap(){
+  if( !dumpMap ){
+    return;
+  }
+  bool rtn = true;
+  if( !rankFile ){
+    rtn = dumpMap->close();
+    delete dumpMap;
+  }else{
+    std::lock_guard<std::mutex> lock(RankMapLock);
+    if( --RankMapRefs == 0 ){
+      rtn = RankMap->close();
+      delete RankMap;
+      RankMap = nullptr;
+    }
+  }
+  dumpMap = nullptr;
+  if( !rtn ){
+    output.output("%s : failed to truncate the dump file\n",
+                  getName().c_str());
+  }
+}
+
+std::unique_lock<std::mutex> TclDbg::lockMap(){
+  openMap();
+  auto start = std::chrono::high_resolution_clock::now();
+  std::unique_lock<std::mutex> lock(dumpMap->mutex);
+  auto stop = std::chrono::high_resolution_clock::now();
+  statLockWait->addData((uint64_t)(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(stop-start).count()));
+  return lock;
+}
+
+void TclDbg::putHeader(uint8_t *p, uint32_t kind, uint64_t cycle){
+  const DumpHeader hdr = {DUMP_MAGIC, kind, (uint64_t)(getId()),
+                          cycle, (uint64_t)(data.size())};
+  std::memcpy(p, &hdr, sizeof(DumpHeader));
+}
+
+bool TclDbg::dumpMmap(uint64_t cycle){
+  const size_t dataBytes = data.size() * sizeof(unsigned);
+  auto lock = lockMap();
+  uint8_t *p = dumpMap->append(sizeof(DumpHeader) + dataBytes);
+  if( !p ){
+    return false;
+  }
+  putHeader(p, DUMP_FULL, cycle);
+  std::memcpy(p + sizeof(DumpHeader), data.data(), dataBytes);
+  return true;
+}
+
+bool TclDbg::dumpDelta(uint64_t cycle, uint64_t& bytes){
+  if( needKey || sizeChanged || dumpsSinceKey >= keyframeInterval ){
+    // keyframe
+    if( !dumpMmap(cycle) ){
+      return false;
+    }
+    bytes = sizeof(DumpHeader) + data.size() * sizeof(unsigned);
+    dumpsSinceKey = 1;
+    needKey = false;
+  }else{
+    // coalesce adjacent dirty chunks into ranges
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    uint64_t words = 0;
+    for( uint64_t c = 0; c < dirty.size(); c++ ){
+      if( !dirty[c] ){
+        continue;
+      }
+      const uint64_t first = c * deltaChunk;
+      const uint64_t last = std::min((c + 1) * deltaChunk, (uint64_t)(data.size()));
+      if( !ranges.empty() && ranges.back().first + ranges.back().second == first ){
+        ranges.back().second += last - first;
+      }else{
+        ranges.emplace_back(first, last - first);
+      }
+      words += last - first;
+    }
+
+    bytes = sizeof(DumpHeader) + sizeof(uint64_t) +
+            ranges.size() * 2 * sizeof(uint64_t) + words * sizeof(unsigned);
+    auto lock = lockMap();
+    uint8_t *p = dumpMap->append(bytes);
+    if( !p ){
+      return false;
+    }
+    const uint64_t nranges = (uint64_t)(ranges.size());
+    putHeader(p, DUMP_DELTA, cycle);
+    p += sizeof(DumpHeader);
+    std::memcpy(p, &nranges, sizeof(uint64_t));
+    p += sizeof(uint64_t);
+    for( const auto& r : ranges ){
+      std::memcpy(p, &r.first, sizeof(uint64_t));
+      p += sizeof(uint64_t);
+      std::memcpy(p, &r.second, sizeof(uint64_t));
+      p += sizeof(uint64_t);
+      std::memcpy(p, &data[r.first], r.second * sizeof(unsigned));
+      p += r.second * sizeof(unsigned);
+    }
+    dumpsSinceKey++;
+  }
+
+  std::fill(dirty.begin(), dirty.end(), 0);
+  sizeChanged = false;
+  return true;
+}
+
+void TclDbg::markDirty(uint64_t first, uint64_t last){
+  dirty.resize((data.size() + deltaChunk - 1) / deltaChunk, 0);
+  for( uint64_t c = first / deltaChunk; c < (last + deltaChunk - 1) / deltaChunk; c++ ){
+    dirty[c] = 1;
+  }
 }
 
 void TclDbg::serialize_order(SST::Core::Serialization::serializer& ser){
@@ -98,11 +483,35 @@ void TclDbg::serialize_order(SST::Core::Serialization::serializer& ser){
   SST_SER(clockDelay)
   SST_SER(clocks)
   SST_SER(curCycle)
+  SST_SER(dumpMode)
+  SST_SER(updateWords)
+  SST_SER(deltaChunk)
+  SST_SER(keyframeInterval)
+  SST_SER(rankFile)
+  SST_SER(dumpPeriod)
   SST_SER(data)
   SST_SER(mersenne)
+  SST_SER(statBytes)
+  SST_SER(statTiming)
+  SST_SER(statLockWait)
+
+  if( ser.mode() == SST::Core::Serialization::serializer::UNPACK ){
+    restored = true;
+  }
 }
 
 void TclDbg::updateData(){
+  if( updateWords > 0 && !data.empty() ){
+    // rewrite a random window and leave the rest of the state untouched
+    const uint64_t len = std::min(updateWords, (uint64_t)(data.size()));
+    const uint64_t first = mersenne->generateNextUInt64() % (data.size() - len + 1);
+    for( uint64_t i = first; i < first + len; i++ ){
+      data[i] = (unsigned)(mersenne->generateNextUInt32());
+    }
+    markDirty(first, first + len);
+    return;
+  }
+
   // generate new data
   data.clear();
   uint64_t range = maxData - minData + 1;
@@ -110,6 +519,7 @@ void TclDbg::updateData(){
   for( unsigned i=0; i<r; i++ ){
     data.push_back((unsigned)(mersenne->generateNextUInt32()));
   }
+  sizeChanged = true;
 }
 
 bool TclDbg::clockTick( SST::Cycle_t currentCycle ){
@@ -121,6 +531,11 @@ bool TclDbg::clockTick( SST::Cycle_t currentCycle ){
     curCycle = 0;
   }
 
+  // periodic dumps independent of wall clock status requests
+  if( dumpPeriod > 0 && ((uint64_t)(currentCycle) % dumpPeriod) == 0 ){
+    printStatus(output);
+  }
+
   // check to see if we've reached the completion state
   if( (uint64_t)(currentCycle) >= clocks ){
     output.verbose(CALL_INFO, 1, 0,
@@ -21,6 +21,18 @@
 // #include <inttypes.h>
 #include <time.h>
 #include <chrono>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstring>
+#include <cinttypes>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 // -- SST Headers
 #include "SST.h"
@@ -41,6 +53,75 @@
 
 namespace SST::TclDbg{
 
+// -------------------------------------------------------
+// Dump output modes
+// -------------------------------------------------------
+enum class DumpMode : uint32_t {
+  Sync  = 0,    ///< SSTDebug::dump on the simulation thread
+  Async = 1,    ///< snapshot to a double buffer; SSTDebug::dump on a writer thread
+  Mmap  = 2,    ///< append binary records to a memory-mapped file
+  Delta = 3,    ///< mmap records holding only the chunks changed since the last dump
+};
+
+// -------------------------------------------------------
+// Mmap dump record header
+// -------------------------------------------------------
+/// Each mmap dump appends a DumpHeader to ./<component>.tdbg, or to the
+/// shared ./tcldbg-rank<n>.tdbg with dumpFile=rank; the file is truncated
+/// to the last record at finish. A run restarted from a checkpoint keeps
+/// the records written before its first dump cycle and appends after them.
+/// A DUMP_FULL header is followed
+/// by `count` 32 bit values. A DUMP_DELTA header is followed by a uint64_t
+/// range count and, per range, a uint64_t start, a uint64_t length and
+/// `length` 32 bit values; values outside the ranges are unchanged since
+/// the previous record. scripts/tdbg-reader.py reconstructs the state.
+struct DumpHeader {
+  uint32_t magic;                                 ///< DUMP_MAGIC
+  uint32_t kind;                                  ///< DUMP_FULL or DUMP_DELTA
+  uint64_t comp;                                  ///< SST component id
+  uint64_t cycle;                                 ///< simulation cycle of the dump
+  uint64_t count;                                 ///< number of 32 bit data values
+};
+
+static constexpr uint32_t DUMP_MAGIC = 0x47424454;  ///< "TDBG"
+static constexpr uint32_t DUMP_FULL  = 0;           ///< full copy of data
+static constexpr uint32_t DUMP_DELTA = 1;           ///< changed ranges of data
+
+// -------------------------------------------------------
+// DumpMap
+// -------------------------------------------------------
+/// Growable memory-mapped append-only dump file. Callers hold `mutex`
+/// around append() and the writes into the returned region.
+class DumpMap{
+public:
+  /// DumpMap: constructor; the file is created on the first append
+  explicit DumpMap(const std::string& path) : path(path) {}
+
+  /// DumpMap: destructor
+  ~DumpMap();
+
+  /// DumpMap: reserve `bytes` at the end of the file
+  uint8_t *append(size_t bytes);
+
+  /// DumpMap: reopen an existing file, keeping the records before `cycle`
+  bool resume(uint64_t cycle);
+
+  /// DumpMap: unmap and truncate the file to the appended bytes
+  bool close();
+
+  std::mutex mutex;                               ///< serializes appends
+
+private:
+  std::string path;                               ///< dump file path
+  int fd = -1;                                    ///< dump file descriptor
+  uint8_t *base = nullptr;                        ///< mapped region
+  size_t size = 0;                                ///< mapped bytes
+  size_t used = 0;                                ///< appended bytes
+
+  /// DumpMap: grow the mapping to at least `need` bytes
+  bool reserve(size_t need);
+};  // class DumpMap
+
 // -------------------------------------------------------
 // TclDbg
 // -------------------------------------------------------
@@ -86,6 +167,12 @@ public:
     {"clocks",          "Clock cycles to execute",              "1000"},
     {"rngSeed",         "Mersenne RNG Seed",                    "1223"},
     {"clockFreq",       "Clock frequency",                      "1GHz"},
+    {"dumpMode",        "printStatus dump mode: sync, async, mmap, delta", "sync"},
+    {"updateWords",     "Values rewritten per update; 0 regenerates all data", "0"},
+    {"deltaChunk",      "Dirty tracking granularity in values (delta mode)",   "256"},
+    {"keyframeInterval","Dumps between full keyframes (delta mode)",           "16"},
+    {"dumpFile",        "mmap/delta dump file: component or rank (shared per rank)", "component"},
+    {"dumpPeriod",      "Clock cycles between printStatus dumps; 0 dumps on status requests only", "0"},
   )
 
   // -------------------------------------------------------
@@ -103,7 +190,8 @@ public:
   // -------------------------------------------------------
   SST_ELI_DOCUMENT_STATISTICS(
     {"statBytes", "Number of bytes written",      "bytes",  1},
-    {"statTiming","Timing info in microseconds",  "usecs",  1},
+    {"statTiming","Blocking time per dump in microseconds",  "usecs",  1},
+    {"statLockWait","Wait for the mmap/delta dump file lock per dump",  "ns",  1},
   )
 
   // -------------------------------------------------------
@@ -131,11 +219,18 @@ private:
   uint64_t clockDelay;                            ///< clock delay between updates
   uint64_t clocks;                                ///< number of clocks to execute
   uint64_t curCycle;                              ///< current cycle delay
+  DumpMode dumpMode = DumpMode::Sync;             ///< printStatus dump mode
+  uint64_t updateWords = 0;                       ///< values rewritten per update
+  uint64_t deltaChunk = 256;                      ///< dirty chunk size in values
+  uint64_t keyframeInterval = 16;                 ///< dumps between keyframes
+  bool rankFile = false;                          ///< dump to the shared per-rank file
+  uint64_t dumpPeriod = 0;                        ///< clock cycles between dumps
 
   std::vector<unsigned> data;                     ///< internal data container
 
   Statistic<uint64_t> *statBytes;                 ///< number of bytes
   Statistic<uint64_t> *statTiming;                ///< timing info
+  Statistic<uint64_t> *statLockWait = nullptr;    ///< dump file lock wait
 
   // -- rng objects
   SST::RNG::Random* mersenne;                     ///< mersenne twister object
@@ -143,10 +238,64 @@ private:
   // -- debugging objects
   SSTDebug *Dbg;                                  ///< debugging object
 
+  // -- async dump state; never serialized
+  std::thread writer;                             ///< background dump writer
+  std::mutex dumpMutex;                           ///< guards the snapshot buffer
+  std::condition_variable dumpCV;                 ///< snapshot ready / consumed
+  std::vector<unsigned> snapBuf;                  ///< snapshot awaiting the writer
+  uint64_t snapCycle = 0;                         ///< cycle of the snapshot
+  bool snapValid = false;                         ///< snapshot awaiting the writer
+  bool writerStop = false;                        ///< writer shutdown request
+  std::atomic<uint64_t> dumpFailures{0};          ///< failed background dumps
+  std::atomic<uint64_t> dumpsWritten{0};          ///< completed dumps of this run
+
+  // -- mmap dump state; never serialized
+  DumpMap *dumpMap = nullptr;                     ///< per-component or per-rank file
+  bool restored = false;                          ///< restarted from a checkpoint
+
+  // -- delta dump state; never serialized
+  std::vector<uint8_t> dirty;                     ///< per-chunk dirty flags
+  bool sizeChanged = true;                        ///< data resized since the last dump
+  bool needKey = true;                            ///< next delta dump starts a file
+  uint64_t dumpsSinceKey = 0;                     ///< dumps since the last keyframe
+
   // -- private methods
   /// TclDbg: update the internal data
   void updateData();
 
+  /// TclDbg: write a dump through SSTDebug
+  bool dumpData(uint64_t cycle, const std::vector<unsigned>& data);
+
+  /// TclDbg: hand a snapshot of data to the writer thread
+  void dumpAsync(uint64_t cycle);
+
+  /// TclDbg: writer thread main loop
+  void writerLoop();
+
+  /// TclDbg: drain pending dumps and join the writer thread
+  void stopWriter();
+
+  /// TclDbg: append a dump record to the mapped file
+  bool dumpMmap(uint64_t cycle);
+
+  /// TclDbg: append a keyframe or a delta record to the mapped file
+  bool dumpDelta(uint64_t cycle, uint64_t& bytes);
+
+  /// TclDbg: mark values [first, last) as changed since the last dump
+  void markDirty(uint64_t first, uint64_t last);
+
+  /// TclDbg: attach the per-component or per-rank dump file
+  void openMap();
+
+  /// TclDbg: detach the dump file; the last user closes it
+  void closeMap();
+
+  /// TclDbg: lock the dump file and record the wait
+  std::unique_lock<std::mutex> lockMap();
+
+  /// TclDbg: write a DumpHeader for the current data at `p`
+  void putHeader(uint8_t *p, uint32_t kind, uint64_t cycle);
+
 };  // class TclDbg
 }   // namespace SST::TclDbg
 
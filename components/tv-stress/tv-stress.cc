@@ -0,0 +1,212 @@
+//
+// _tv_stress_cc_
+//
+// Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+// All Rights Reserved
+// contact@tactcomplabs.com
+//
+// See LICENSE in the top level directory for licensing details
+//
+
+#include "tv-stress.h"
+
+namespace SST::TvStress{
+
+//------------------------------------------
+// TvStress
+//------------------------------------------
+TvStress::TvStress(SST::ComponentId_t id, const SST::Params& params ) :
+  SST::Component( id ), numPorts(0), depth(16), dist(DelayDist::UNIFORM),
+  minDelay(1), maxDelay(1000), meanDelay(100), paretoShape(1.5),
+  rngSeed(31337), numSent(0), numRecv(0), stopped(false) {
+
+  uint32_t Verbosity = params.find<uint32_t>("verbose", 0);
+  output.init(
+    "TvStress[" + getName() + ":@p:@t]: ",
+    Verbosity, 0, SST::Output::STDOUT );
+
+  // register our component
+  registerAsPrimaryComponent();
+  primaryComponentDoNotEndSim();
+
+  // read the rest of the parameters
+  numPorts = params.find<uint64_t>("numPorts", 0);
+  depth = params.find<uint64_t>("depth", 16);
+  minDelay = params.find<uint64_t>("minDelay", 1);
+  maxDelay = params.find<uint64_t>("maxDelay", 1000);
+  meanDelay = params.find<uint64_t>("meanDelay", 100);
+  paretoShape = params.find<double>("paretoShape", 1.5);
+  timeBase = params.find<std::string>("timeBase", "1ns");
+  stopTime = params.find<std::string>("stopTime", "1ms");
+  rngSeed = params.find<uint32_t>("rngSeed", 31337);
+
+  // resolve the distribution once rather than per event
+  std::string d = params.find<std::string>("delayDist", "uniform");
+  if( d == "uniform" ){
+    dist = DelayDist::UNIFORM;
+  }else if( d == "exponential" ){
+    dist = DelayDist::EXPONENTIAL;
+  }else if( d == "pareto" ){
+    dist = DelayDist::PARETO;
+  }else if( d == "constant" ){
+    dist = DelayDist::CONSTANT;
+  }else{
+    output.fatal(CALL_INFO, -1, "%s : unknown delayDist=%s\n",
+                 getName().c_str(), d.c_str());
+  }
+
+  // sanity check the params
+  if( maxDelay < minDelay ){
+    output.fatal(CALL_INFO, -1, "%s : maxDelay < minDelay\n",
+                 getName().c_str());
+  }
+  if( paretoShape <= 0.0 ){
+    output.fatal(CALL_INFO, -1, "%s : paretoShape must be > 0\n",
+                 getName().c_str());
+  }
+  UnitAlgebra ua(stopTime);
+  if( !ua.hasUnits("s") ){
+    output.fatal(CALL_INFO, -1,
+                 "%s : stopTime must be specified in units of time: %s\n",
+                 getName().c_str(), stopTime.c_str());
+  }
+
+  // the self link keeps events local to this component's TimeVortex;
+  // each handler carries the index of its link in linkHandlers
+  linkHandlers.push_back(configureSelfLink("self", timeBase,
+                                           new Event::Handler2<TvStress,
+                                           &TvStress::handleEvent,
+                                           uint64_t>(this, 0)));
+  for( uint64_t i = 0; i<numPorts; i++ ){
+    SST::Link* l = configureLink("port" + std::to_string(i), timeBase,
+                                 new Event::Handler2<TvStress,
+                                 &TvStress::handleEvent,
+                                 uint64_t>(this, linkHandlers.size()));
+    if( l )
+      linkHandlers.push_back(l);
+  }
+  stopLink = configureSelfLink("stopLink", stopTime,
+                               new Event::Handler2<TvStress,
+                               &TvStress::handleStop>(this));
+
+  // setup the local rand number generator
+  localRNG = new SST::RNG::MersenneRNG(uint32_t(id) + rngSeed);
+
+  // initialize the statistics
+  EStat = registerStatistic<uint64_t>("EVENTS");
+  RStat = registerStatistic<uint64_t>("EVENT_RATE");
+  DStat = registerStatistic<uint64_t>("DELAY");
+
+  // constructor complete
+  output.verbose( CALL_INFO, 5, 0, "Constructor complete\n" );
+}
+
+TvStress::~TvStress(){
+  if( localRNG ) delete localRNG;
+}
+
+void TvStress::setup(){
+  for( uint64_t i = 0; i<depth; i++ ){
+    uint64_t target = 0;
+    if( linkHandlers.size() > 1 )
+      target = localRNG->generateNextUInt64() % linkHandlers.size();
+    sendEvent(target);
+  }
+  stopLink->send(1, new TvStressEvent());
+  wallStart = std::chrono::steady_clock::now();
+  recvAtStart = numRecv;
+  output.verbose( CALL_INFO, 5, 0, "Setup complete\n" );
+}
+
+void TvStress::finish(){
+  if( !stopped )
+    wallStop = std::chrono::steady_clock::now();
+  double secs = std::chrono::duration<double>(wallStop - wallStart).count();
+  uint64_t events = numRecv - recvAtStart;
+  uint64_t rate = secs > 0.0 ? (uint64_t)((double)events / secs) : 0;
+  EStat->addData(numRecv);
+  RStat->addData(rate);
+  output.verbose( CALL_INFO, 1, 0,
+                  "received %" PRIu64 " events in %.6f s : %" PRIu64 " events/s\n",
+                  events, secs, rate );
+  output.verbose( CALL_INFO, 5, 0, "Finish complete\n" );
+}
+
+void TvStress::serialize_order(SST::Core::Serialization::serializer& ser){
+  SST::Component::serialize_order(ser);
+  SST_SER(numPorts);
+  SST_SER(depth);
+  SST_SER(dist);
+  SST_SER(minDelay);
+  SST_SER(maxDelay);
+  SST_SER(meanDelay);
+  SST_SER(paretoShape);
+  SST_SER(timeBase);
+  SST_SER(stopTime);
+  SST_SER(rngSeed);
+  SST_SER(numSent);
+  SST_SER(numRecv);
+  SST_SER(stopped);
+  SST_SER(linkHandlers);
+  SST_SER(stopLink);
+  SST_SER(localRNG);
+  SST_SER(EStat);
+  SST_SER(RStat);
+  SST_SER(DStat);
+  // wall clock rates restart from the restore point
+  if( ser.mode() == SST::Core::Serialization::serializer::UNPACK ){
+    wallStart = std::chrono::steady_clock::now();
+    recvAtStart = numRecv;
+  }
+}
+
+void TvStress::handleStop(SST::Event *ev){
+  delete ev;
+  wallStop = std::chrono::steady_clock::now();
+  stopped = true;
+  output.verbose( CALL_INFO, 1, 0, "stop time %s reached\n", stopTime.c_str() );
+  primaryComponentOKToEndSim();
+}
+
+void TvStress::handleEvent(SST::Event *ev, uint64_t link){
+  delete ev;
+  if( stopped )
+    return;
+  numRecv+=1;
+  // reply on the arrival link: every link keeps the events it was given in
+  // setup, so each component's share of the in-flight events does not drift
+  sendEvent(link);
+}
+
+SimTime_t TvStress::nextDelay(){
+  double u = localRNG->nextUniform();
+  double d = 0.0;
+  switch( dist ){
+  case DelayDist::UNIFORM:
+    d = (double)minDelay + (double)(maxDelay - minDelay + 1) * u;
+    break;
+  case DelayDist::EXPONENTIAL:
+    d = -(double)meanDelay * std::log(1.0 - u);
+    break;
+  case DelayDist::PARETO:
+    d = (double)minDelay / std::pow(1.0 - u, 1.0 / paretoShape);
+    break;
+  case DelayDist::CONSTANT:
+    d = (double)meanDelay;
+    break;
+  }
+  // clamp the tails so a single sample cannot stall the run
+  if( d > (double)maxDelay )
+    d = (double)maxDelay;
+  return (SimTime_t)d;
+}
+
+void TvStress::sendEvent(uint64_t target){
+  SimTime_t delay = nextDelay();
+  linkHandlers[target]->send(delay, new TvStressEvent(numSent++));
+  DStat->addData(delay);
+}
+
+} // namespace SST::TvStress
+
+// EOF
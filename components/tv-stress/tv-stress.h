@@ -0,0 +1,199 @@
+//
+// _tv_stress_h_
+//
+// Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+// All Rights Reserved
+// contact@tactcomplabs.com
+//
+// See LICENSE in the top level directory for licensing details
+//
+
+#ifndef _SST_TV_STRESS_H_
+#define _SST_TV_STRESS_H_
+
+// -- Standard Headers
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+// clang-format off
+// -- SST Headers
+#include "SST.h"
+#include <sst/core/rng/rng.h>
+#include <sst/core/rng/mersenne.h>
+// clang-format on
+
+namespace SST::TvStress{
+
+// -------------------------------------------------------
+// TvStressEvent
+// -------------------------------------------------------
+class TvStressEvent : public SST::Event{
+public:
+  /// TvStressEvent : standard constructor
+  TvStressEvent() : SST::Event() {}
+
+  /// TvStressEvent: constructor
+  TvStressEvent(uint64_t s) : SST::Event(), seq(s) {}
+
+  /// TvStressEvent: destructor
+  ~TvStressEvent() {}
+
+  /// TvStressEvent: retrieve the sequence number
+  uint64_t getSeq() const { return seq; }
+
+private:
+  uint64_t seq = 0;             ///< TvStressEvent: sender sequence number
+
+  /// TvStressEvent: serialization method
+  void serialize_order(SST::Core::Serialization::serializer& ser) override{
+    Event::serialize_order(ser);
+    SST_SER(seq);
+  }
+
+  /// TvStressEvent: serialization implementor
+  ImplementSerializable(SST::TvStress::TvStressEvent);
+
+};  // class TvStressEvent
+
+// -------------------------------------------------------
+// TvStress
+// -------------------------------------------------------
+class TvStress final : public SST::Component{
+public:
+  /// TvStress: delay distributions
+  enum class DelayDist : uint32_t {
+    UNIFORM     = 0,    ///< uniform in [minDelay, maxDelay]
+    EXPONENTIAL = 1,    ///< exponential with mean meanDelay
+    PARETO      = 2,    ///< heavy-tailed pareto starting at minDelay
+    CONSTANT    = 3,    ///< every event uses meanDelay
+  };
+
+  /// TvStress: top-level SST component constructor
+  TvStress( SST::ComponentId_t id, const SST::Params& params );
+
+  /// TvStress: top-level SST destructor
+  ~TvStress();
+
+  /// TvStress: standard SST component 'setup' function
+  void setup() override;
+
+  /// TvStress: standard SST component 'finish' function
+  void finish() override;
+
+  // -------------------------------------------------------
+  // TvStress Component Registration Data
+  // -------------------------------------------------------
+  /// TvStress: Register the component with the SST core
+  SST_ELI_REGISTER_COMPONENT( TvStress,       // component class
+                              "tvstress",     // component library
+                              "TvStress",     // component name
+                              SST_ELI_ELEMENT_VERSION( 1, 0, 0 ),
+                              "TIMEVORTEX STRESS SST COMPONENT",
+                              COMPONENT_CATEGORY_UNCATEGORIZED )
+
+  SST_ELI_DOCUMENT_PARAMS(
+    {"verbose",     "Sets the verbosity level",                                   "0" },
+    {"numPorts",    "Sets the number of external ports (0 uses the self link only)", "0" },
+    {"depth",       "Sets the number of events each component injects; the per-component average in flight with ports", "16"},
+    {"delayDist",   "Sets the delay distribution: uniform|exponential|pareto|constant", "uniform"},
+    {"minDelay",    "Sets the minimum delay (uniform, pareto) in timeBase units",   "1"},
+    {"maxDelay",    "Sets the maximum delay (all distributions) in timeBase units", "1000"},
+    {"meanDelay",   "Sets the mean delay (exponential) or fixed delay (constant)", "100"},
+    {"paretoShape", "Sets the pareto shape parameter; smaller is heavier tailed",  "1.5"},
+    {"timeBase",    "Sets the time base for delays",                               "1ns"},
+    {"stopTime",    "Sets the simulated time at which the component stops",        "1ms"},
+    {"rngSeed",     "Sets the RNG seed",                                           "31337"},
+  )
+
+  // -------------------------------------------------------
+  // TvStress Component Port Data
+  // -------------------------------------------------------
+  SST_ELI_DOCUMENT_PORTS(
+    {"port%(num_ports)d",
+      "Ports which connect to endpoints.",
+      {"tvstress.TvStressEvent", ""}
+    }
+  )
+
+  // -------------------------------------------------------
+  // TvStress SubComponent Parameter Data
+  // -------------------------------------------------------
+  SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS()
+
+  // -------------------------------------------------------
+  // TvStress Component Statistics Data
+  // -------------------------------------------------------
+  SST_ELI_DOCUMENT_STATISTICS(
+    {"EVENTS",     "Number of events received before the stop time", "events", 1},
+    {"EVENT_RATE", "Events received per wall clock second",          "events/s", 1},
+    {"DELAY",      "Histogram of sampled delays",                     "timeBase", 2},
+  )
+
+  // -------------------------------------------------------
+  // TvStress Component Checkpoint Methods
+  // -------------------------------------------------------
+  /// TvStress: serialization constructor
+  TvStress() : SST::Component() {}
+
+  /// TvStress serialization
+  void serialize_order(SST::Core::Serialization::serializer& ser) override;
+
+  /// TvStress: serialization implementations
+  ImplementSerializable(SST::TvStress::TvStress);
+
+private:
+  // -- internal handlers
+  SST::Output    output;                          ///< SST output handler
+
+  // -- parameters
+  uint64_t numPorts;                              ///< number of external ports
+  uint64_t depth;                                 ///< target in-flight events
+  DelayDist dist;                                 ///< delay distribution
+  uint64_t minDelay;                              ///< minimum delay
+  uint64_t maxDelay;                              ///< maximum delay
+  uint64_t meanDelay;                             ///< mean or fixed delay
+  double paretoShape;                             ///< pareto shape parameter
+  std::string timeBase;                           ///< time base for delays
+  std::string stopTime;                           ///< simulated stop time
+  uint32_t rngSeed;                               ///< rng seed
+
+  // -- internal state
+  uint64_t numSent;                               ///< number of events sent
+  uint64_t numRecv;                               ///< number of events received
+  bool stopped;                                   ///< stop time has been reached
+  std::vector<SST::Link *> linkHandlers;          ///< target links; self link first
+  SST::Link* stopLink = nullptr;                  ///< self link that fires at stopTime
+  SST::RNG::Random* localRNG = 0;                 ///< component local random number generator
+
+  // -- wall clock accounting; reset on restart
+  std::chrono::steady_clock::time_point wallStart;
+  std::chrono::steady_clock::time_point wallStop;
+  uint64_t recvAtStart = 0;                       ///< numRecv when wallStart was taken
+
+  Statistic<uint64_t>* EStat;                     ///< events received
+  Statistic<uint64_t>* RStat;                     ///< events per wall clock second
+  Statistic<uint64_t>* DStat;                     ///< sampled delays
+
+  // -- private methods
+  /// TvStress: Event handler; every receipt re-injects one event on the same link
+  void handleEvent(SST::Event *ev, uint64_t link);
+
+  /// TvStress: Stop time handler
+  void handleStop(SST::Event *ev);
+
+  /// TvStress: Sends one event on linkHandlers[target]
+  void sendEvent(uint64_t target);
+
+  /// TvStress: Samples the next delay from the selected distribution
+  SimTime_t nextDelay();
+
+};
+
+} // namespace SST::TvStress
+
+#endif  // _SST_TV_STRESS_H_
+
+// EOF
@@ -0,0 +1,385 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# perfanalysis.py
+#
+# Analysis of the sqlite3 database written by sst-sweeper.py and the
+# jenkins perf.slurm scripts.
+#
+#   scaling      strong or weak scaling speedup and efficiency of BASE jobs
+#   cpt-overhead checkpoint cost of each CPT job relative to its friend BASE job
+#   baseline     store per configuration metrics as a json baseline
+#   compare      flag regressions of the current database against a baseline
+#
+# A configuration is identified by job type, ranks, threads, sdl parameters,
+# sst version, sst options and, for RST jobs, the checkpoint number. When a
+# database holds several runs of one configuration the most recent (largest
+# jobid) is used.
+#
+
+import argparse
+import json
+import os
+import sqlite3
+import sys
+
+from collections import OrderedDict
+from datetime import datetime
+
+g_pfx = "[perfanalysis.py]"
+
+# metric : (better, relative tolerance, absolute floor)
+# A metric regresses when it is worse than the baseline by more than
+# max(relative tolerance * |baseline|, absolute floor).
+defaultTolerances = OrderedDict([
+    ("max_run_time",   ("lower",  0.05, 0.05)),    # seconds
+    ("max_total_time", ("lower",  0.05, 0.05)),    # seconds
+    ("global_max_rss", ("lower",  0.10, 1024)),    # kB
+    ("cpt_overhead",   ("lower",  0.10, 0.02)),    # cpt run time / base run time - 1
+    ("ipc",            ("higher", 0.05, 0.0)),     # instructions per cycle
+])
+
+def sst_options(jobstring:str) -> str:
+    # sst options of the job string without paths, run files or the thread count
+    tokens = (jobstring or "").split()
+    if "sst" not in tokens:
+        return ""
+    opts = []
+    for t in tokens[tokens.index("sst") + 1:]:
+        if t == "--":
+            break
+        if not t.startswith("--"):
+            continue    # sdl file or the value of --parallel-load / --load-checkpoint
+        name, eq, value = t.partition("=")
+        if name == "--num-threads":
+            continue
+        opts.append(name if "/" in value else t)
+    return ' '.join(sorted(opts))
+
+class Job():
+
+    def __init__(self, row:dict, sdlKeys:list):
+        self.jobid = row["jobid"]
+        self.jobtype = row["jobtype"]
+        self.jobname = row["jobname"]
+        self.friend = row["friend"]
+        self.cpt_num = row["cpt_num"]
+        self.ranks = row["ranks"]
+        self.threads = row["threads"]
+        self.pes = self.ranks * self.threads
+        self.sdl = OrderedDict([(k, row[k]) for k in sdlKeys])
+        self.sst_version = row["sst_version"]
+        self.sst_opts = sst_options(row["jobstring"])
+        self.metrics = OrderedDict()
+        for m in ["max_run_time", "max_total_time", "global_max_rss", "ipc"]:
+            if row.get(m) != None:
+                self.metrics[m] = row[m]
+        self.cpt_dirs = row.get("cpt_dirs")
+        self.cpt_bytes = row.get("cpt_bin_size_total")
+
+    def sdl_str(self, skip=None) -> str:
+        return ' '.join([f"{k}={v}" for k, v in self.sdl.items() if k != skip])
+
+    def sst_str(self) -> str:
+        return f"sst={self.sst_version} {self.sst_opts}".strip()
+
+    def key(self) -> str:
+        k = f"{self.jobtype} r{self.ranks} t{self.threads} {self.sdl_str()} {self.sst_str()}"
+        if self.jobtype == "RST":
+            k += f" cpt={self.cpt_num}"
+        return k
+
+class perfdb():
+
+    def __init__(self, dbFile:str, jobname:str=None, jobids:list=None):
+        if not os.path.isfile(dbFile):
+            print(f"{g_pfx} error: could not find database {dbFile}")
+            sys.exit(1)
+        self.con = sqlite3.connect(dbFile)
+        self.con.row_factory = sqlite3.Row
+        self.cur = self.con.cursor()
+        self.tables = [r[0] for r in self.cur.execute("SELECT name FROM sqlite_master WHERE type='table'")]
+        for t in ["job_info", "timing_info", "sdl_info"]:
+            if t not in self.tables:
+                print(f"{g_pfx} error: {dbFile} has no {t} table")
+                sys.exit(1)
+        self.sdlKeys = [r[1] for r in self.cur.execute("PRAGMA table_info(sdl_info)") if r[1] != "jobid"]
+        self.jobs = self.load(jobname, jobids)
+        # job lookup and latest job of each configuration
+        self.byid = { j.jobid : j for j in self.jobs }
+        self.latest = OrderedDict()
+        for j in sorted(self.jobs, key=lambda j: j.jobid):
+            self.latest[j.key()] = j
+
+    def close(self):
+        self.con.close()
+
+    def load(self, jobname:str, jobids:list) -> list:
+        cols = "J.jobid, J.jobtype, J.jobname, J.friend, J.cpt_num, J.jobstring, J.sst_version, T.ranks, T.threads, " \
+               "T.max_run_time, T.max_total_time, T.global_max_rss"
+        joins = "JOIN timing_info T ON T.jobid = J.jobid JOIN sdl_info S ON S.jobid = J.jobid"
+        if len(self.sdlKeys) > 0:
+            cols += ", " + ', '.join([f"S.{k}" for k in self.sdlKeys])
+        # optional tables
+        if "file_info" in self.tables:
+            cols += ", F.cpt_dirs, F.cpt_bin_size_total"
+            joins += " LEFT JOIN file_info F ON F.jobid = J.jobid"
+        if "perf_info" in self.tables:
+            cols += ", P.ipc"
+            joins += " LEFT JOIN perf_info P ON P.jobid = J.jobid"
+        qy = f"SELECT {cols} FROM job_info J {joins}"
+        conds = []
+        data = ()
+        if jobname != None:
+            conds.append("J.jobname = ?")
+            data += ( jobname, )
+        if jobids != None:
+            conds.append(f"J.jobid IN ({', '.join(['?' for i in jobids])})")
+            data += tuple(jobids)
+        if len(conds) > 0:
+            qy += " WHERE " + " AND ".join(conds)
+        qy += " ORDER BY J.jobid"
+        return [Job(dict(r), self.sdlKeys) for r in self.cur.execute(qy, data)]
+
+    # scaling subcommand
+    def scaling(self, *, jobtype:str="BASE", weak:str=None, metric:str="max_run_time") -> list:
+        # strong: fixed sdl parameters, increasing ranks*threads
+        # weak:   sdl parameter `weak` proportional to ranks*threads, others fixed
+        if weak != None and weak not in self.sdlKeys:
+            print(f"{g_pfx} error: weak scaling parameter {weak} not in sdl_info {self.sdlKeys}")
+            sys.exit(1)
+        groups = OrderedDict()
+        for j in self.latest.values():
+            if j.jobtype != jobtype or j.metrics.get(metric) == None:
+                continue
+            if weak == None:
+                gkey = f"{j.sdl_str()} {j.sst_str()}"
+            else:
+                gkey = f"{j.sdl_str(skip=weak)} {weak}/pe={float(j.sdl[weak]) / j.pes:g} {j.sst_str()}".strip()
+            groups.setdefault(gkey, []).append(j)
+        rows = []
+        for gkey, jobs in groups.items():
+            jobs.sort(key=lambda j: (j.pes, j.ranks))
+            ref = jobs[0]
+            tref = ref.metrics[metric]
+            for j in jobs:
+                t = j.metrics[metric]
+                if t <= 0 or tref <= 0:
+                    speedup = 0.0
+                elif weak == None:
+                    speedup = tref / t
+                else:
+                    # scaled speedup: work grows with the processing elements
+                    speedup = ( j.pes / ref.pes ) * ( tref / t )
+                efficiency = speedup * ref.pes / j.pes
+                rows.append(OrderedDict([
+                    ("group", gkey), ("jobid", j.jobid), ("ranks", j.ranks), ("threads", j.threads),
+                    ("pes", j.pes), (metric, t), ("speedup", speedup), ("efficiency", efficiency)]))
+        return rows
+
+    # cpt-overhead subcommand
+    def cpt_overhead(self) -> list:
+        rows = []
+        for j in self.latest.values():
+            if j.jobtype != "CPT":
+                continue
+            base = self.byid.get(j.friend)
+            if base == None:
+                print(f"{g_pfx} warning: CPT job {j.jobid} friend {j.friend} not found")
+                continue
+            tcpt = j.metrics.get("max_run_time")
+            tbase = base.metrics.get("max_run_time")
+            if tcpt == None or tbase == None or tbase <= 0:
+                continue
+            ncpt = j.cpt_dirs if j.cpt_dirs else 0
+            rows.append(OrderedDict([
+                ("config", j.key()), ("jobid", j.jobid), ("friend", base.jobid),
+                ("base_run_time", tbase), ("cpt_run_time", tcpt),
+                ("cpt_overhead", tcpt / tbase - 1.0),
+                ("checkpoints", ncpt),
+                ("sec_per_cpt", ( tcpt - tbase ) / ncpt if ncpt > 0 else 0.0),
+                ("cpt_bytes", j.cpt_bytes if j.cpt_bytes else 0)]))
+        return rows
+
+    def config_metrics(self) -> OrderedDict:
+        # metrics of the latest job of each configuration
+        configs = OrderedDict()
+        for key, j in self.latest.items():
+            configs[key] = OrderedDict(j.metrics)
+        for r in self.cpt_overhead():
+            configs[r["config"]]["cpt_overhead"] = r["cpt_overhead"]
+        return configs
+
+    # baseline subcommand
+    def baseline(self, *, outFile:str, tolerances:dict):
+        configs = self.config_metrics()
+        if len(configs) == 0:
+            print(f"{g_pfx} error: no jobs with timing information to record")
+            sys.exit(1)
+        bl = OrderedDict([
+            ("date", datetime.now().strftime("%Y.%m.%d %H:%M")),
+            ("tolerances", OrderedDict([
+                (m, OrderedDict([("better", t[0]), ("rel", t[1]), ("floor", t[2])])) for m, t in tolerances.items()])),
+            ("configs", configs)])
+        with open(outFile, "w") as f:
+            json.dump(bl, f, indent=2)
+        print(f"{g_pfx} wrote {len(configs)} configurations to {outFile}")
+
+    # compare subcommand; returns the number of regressions
+    def compare(self, *, baselineFile:str, overrides:dict, verbose:bool=False) -> int:
+        try:
+            with open(baselineFile) as f:
+                bl = json.load(f)
+        except (FileNotFoundError, json.JSONDecodeError) as e:
+            print(f"{g_pfx} error: could not read baseline {baselineFile}: {e}")
+            sys.exit(1)
+        tolerances = OrderedDict(defaultTolerances)
+        for m, t in bl.get("tolerances", {}).items():
+            tolerances[m] = ( t["better"], t["rel"], t["floor"] )
+        for m, t in overrides.items():
+            tolerances[m] = ( tolerances[m][0], t[0], t[1] if t[1] != None else tolerances[m][2] )
+        blconfigs = bl.get("configs", {})
+        configs = self.config_metrics()
+        regressions = 0
+        improvements = 0
+        compared = 0
+        for key, metrics in configs.items():
+            if key not in blconfigs:
+                continue
+            compared += 1
+            for m, v in metrics.items():
+                b = blconfigs[key].get(m)
+                if b == None or m not in tolerances:
+                    continue
+                better, rel, floor = tolerances[m]
+                worse = v - b if better == "lower" else b - v
+                limit = max(rel * abs(b), floor)
+                change = f"{100.0 * (v - b) / b:+.1f}%" if b != 0 else f"{v - b:+g}"
+                if worse > limit:
+                    regressions += 1
+                    print(f"{g_pfx} REGRESSION {key} : {m} {b:g} -> {v:g} ({change})")
+                elif -worse > limit:
+                    improvements += 1
+                    print(f"{g_pfx} improved   {key} : {m} {b:g} -> {v:g} ({change})")
+                elif verbose:
+                    print(f"{g_pfx} ok         {key} : {m} {b:g} -> {v:g} ({change})")
+        missing = len([k for k in blconfigs if k not in configs])
+        added = len([k for k in configs if k not in blconfigs])
+        print(f"{g_pfx} compare: {compared} configurations, {regressions} regressions, {improvements} improvements, "
+              f"{missing} only in baseline, {added} not in baseline")
+        return regressions
+
+def write_rows(rows:list, outFile:str):
+    # csv to the file or stdout
+    if len(rows) == 0:
+        print(f"{g_pfx} no matching jobs")
+        return
+    lines = [','.join(rows[0].keys())]
+    for r in rows:
+        lines.append(','.join([f"{v:.4f}" if isinstance(v, float) else f"{v}" for v in r.values()]))
+    if outFile == None:
+        print('\n'.join(lines))
+    else:
+        with open(outFile, "w") as f:
+            f.write('\n'.join(lines) + '\n')
+        print(f"{g_pfx} wrote {len(rows)} rows to {outFile}")
+
+def parse_tolerances(tols:list) -> dict:
+    # metric=rel[:floor]
+    d = {}
+    for t in tols if tols else []:
+        try:
+            m, v = t.split("=")
+            rel, _, floor = v.partition(":")
+            d[m] = ( float(rel), float(floor) if floor else None )
+        except ValueError:
+            print(f"{g_pfx} error: tolerance '{t}' is not metric=rel[:floor]")
+            sys.exit(1)
+        if m not in defaultTolerances:
+            print(f"{g_pfx} error: unknown tolerance metric {m}. Use one of {list(defaultTolerances.keys())}")
+            sys.exit(1)
+    return d
+
+# subcommand wrappers
+def _scaling(db:perfdb, args):
+    write_rows(db.scaling(jobtype=args.jobtype, weak=args.weak, metric=args.metric), args.out)
+    return 0
+
+def _cpt_overhead(db:perfdb, args):
+    write_rows(db.cpt_overhead(), args.out)
+    return 0
+
+def _baseline(db:perfdb, args):
+    tolerances = OrderedDict(defaultTolerances)
+    for m, t in parse_tolerances(args.tol).items():
+        tolerances[m] = ( tolerances[m][0], t[0], t[1] if t[1] != None else tolerances[m][2] )
+    db.baseline(outFile=args.out, tolerances=tolerances)
+    return 0
+
+def _compare(db:perfdb, args):
+    return 1 if db.compare(baselineFile=args.baseline, overrides=parse_tolerances(args.tol), verbose=args.verbose) > 0 else 0
+
+if __name__ == '__main__':
+
+    # main parser
+    parser = argparse.ArgumentParser(
+        prog="perfanalysis.py",
+        description="Scaling, checkpoint overhead and regression analysis of sst-sweeper databases")
+    # common args
+    parent_parser = argparse.ArgumentParser(add_help=False)
+    parent_parser.add_argument("--db", type=str, default="timing.db", help="sqlite database file [timing.db]")
+    parent_parser.add_argument("--jobname", type=str, help="only use jobs with this jobname [all jobs]")
+    tol_help = f"override a tolerance as metric=rel[:floor]; metrics {list(defaultTolerances.keys())}"
+    # sub-parsers
+    subparsers = parser.add_subparsers(title="subcommands", dest="subcommand", help='available subcommands. Use {subcommand --help} for more detail')
+    # scaling
+    parser_scaling = subparsers.add_parser(
+        'scaling',
+        help='speedup and efficiency over ranks*threads as csv',
+        parents=[parent_parser])
+    parser_scaling.set_defaults(func=_scaling)
+    parser_scaling.add_argument("--weak", type=str, help="sdl parameter scaled with ranks*threads (sweep depvar) for weak scaling [strong scaling]")
+    parser_scaling.add_argument("--jobtype", type=str, default="BASE", help="job type to analyze [BASE]")
+    parser_scaling.add_argument("--metric", type=str, default="max_run_time", help="timing_info time column [max_run_time]")
+    parser_scaling.add_argument("--out", type=str, help="csv output file [stdout]")
+    # cpt-overhead
+    parser_cpt = subparsers.add_parser(
+        'cpt-overhead',
+        help='run time overhead of CPT jobs relative to their friend BASE jobs as csv',
+        parents=[parent_parser])
+    parser_cpt.set_defaults(func=_cpt_overhead)
+    parser_cpt.add_argument("--out", type=str, help="csv output file [stdout]")
+    # baseline
+    parser_baseline = subparsers.add_parser(
+        'baseline',
+        help='store the metrics of each configuration as a json baseline',
+        parents=[parent_parser])
+    parser_baseline.set_defaults(func=_baseline)
+    parser_baseline.add_argument("--out", type=str, required=True, help="baseline json file to write")
+    parser_baseline.add_argument("--tol", type=str, action="append", help=tol_help)
+    # compare
+    parser_compare = subparsers.add_parser(
+        'compare',
+        help='flag regressions against a json baseline; exit status 1 on regression',
+        parents=[parent_parser])
+    parser_compare.set_defaults(func=_compare)
+    parser_compare.add_argument("--baseline", type=str, required=True, help="baseline json file")
+    parser_compare.add_argument("--tol", type=str, action="append", help=tol_help)
+    parser_compare.add_argument("--verbose", action="store_true", help="also print metrics within tolerance")
+
+    # validate user input
+    args = parser.parse_args()
+    if hasattr(args, 'func') == False:
+        parser.print_help()
+        sys.exit(1)
+
+    db = perfdb(args.db, jobname=args.jobname)
+    rc = args.func(db, args)
+    db.close()
+    sys.exit(rc)
@@ -45,6 +45,10 @@ fileInfoTable = "file_info"
 slurmInfoTable = "slurm_info"
 confInfoTable = "conf_info"
 sdlInfoTable = "sdl_info"
+digestInfoTable = "digest_info"
+perfInfoTable = "perf_info"
+restartInfoTable = "restart_info"
+cacheInfoTable = "cache_info"
 
 # Tables generated with custom colums
 sdlInfoTable = "sdl_info"
@@ -64,7 +68,8 @@ keyDict = {
         "jobnodes",   # nodes requests with job submission
         "sst_version",
         "os_type",
-        "date"
+        "date",
+        "reuse_of"    # jobid whose results sst-sweeper.py reused for this job, else 0
     ],
     timingInfoTable : [
         "local_max_rss",
@@ -118,7 +123,46 @@ keyDict = {
         "checkpoint-wall-period", # "0"
     ],
     # Generated from sdl_params dictionary passed in by caller
-    sdlInfoTable: []
+    sdlInfoTable: [],
+    # Combined run digest from the per-rank 'rundigest: ...' finish reports
+    digestInfoTable: [
+        "digest",       # sum of all component digests modulo 2^64 (hex string)
+        "components",   # number of components reporting a digest
+        "events",       # total number of events recorded
+    ],
+    # Hardware counters summed over the 'perfstats: ...' per-thread finish reports
+    perfInfoTable: [
+        "threads",        # number of threads reporting counters
+        "cycles",         # user space cycles
+        "instructions",   # user space instructions
+        "cache_misses",   # last level cache misses
+        "branch_misses",  # branch mispredictions
+        "ipc",            # instructions per cycle
+        "cache_mpki",     # cache misses per 1000 instructions
+    ],
+    # RST job restart breakdown; timing from timing.json and the per-rank
+    # 'cptstats: ...' deserialize reports
+    restartInfoTable: [
+        "cpt_jobid",          # CPT friend job that wrote the checkpoint
+        "cpt_num",            # checkpoint number
+        "load_time",          # checkpoint load (build) time, max_build_time (s)
+        "resume_time",        # run loop time after the restart, max_run_time (s)
+        "cpt_read_bytes",     # size of the checkpoint files loaded
+        "ranks",              # ranks reporting deserialize totals
+        "components",         # components deserialized
+        "deser_ns_max",       # max over ranks of the summed component deserialize time
+        "deser_ns_min",       # min over ranks of the summed component deserialize time
+        "deser_ns_ave",       # average over ranks of the summed component deserialize time
+        "deser_comp_ns_max",  # longest single component deserialize time
+        "deser_bytes_max",    # max over ranks of the deserialized bytes
+        "deser_bytes_total",  # deserialized bytes over all ranks
+    ],
+    # sst-sweeper.py result cache of successful jobs
+    cacheInfoTable: [
+        "hash",      # sha256 of sst --version output, component libraries, sdl file, job settings and friend hash
+        "jobtype",   # BASE, CPT, RST, PLOAD
+        "jobpath",   # run directory holding the job's files
+    ]
 }
 
 def log_sql_callback(statement):
@@ -150,6 +194,14 @@ class sqldb():
         for table in keyDict:
             qy = f"CREATE TABLE IF NOT EXISTS {table} (jobid INTEGER PRIMARY KEY, {self.sqlKeyStrings[table]})"
             self.cur.execute(qy)
+            # databases written before a column was added get it appended; the
+            # sdl_info columns depend on the caller and are left as created
+            if table == sdlInfoTable:
+                continue
+            cols = [r[1] for r in self.cur.execute(f"PRAGMA table_info({table})")]
+            for k in self.sqlKeyStrings[table].split(', '):
+                if k and k not in cols:
+                    self.cur.execute(f"ALTER TABLE {table} ADD COLUMN {k}")
         self.con.commit()
 
     def commit(self):
@@ -165,18 +217,38 @@ class sqldb():
         data = ( jobid, )
         for k in self.sortedKeyDict[tableName]:
             data += ( jsonInfo[k], )
-        self.cur.execute(f"INSERT INTO {tableName} VALUES( {self.sqlQStrings[tableName]})", data)
+        self.cur.execute(f"INSERT INTO {tableName} (jobid, {self.sqlKeyStrings[tableName]}) VALUES( {self.sqlQStrings[tableName]})", data)
 
     def insertRecord(self, jobid, dataDict, tableName):
         data = ( jobid, )
         for k in self.sortedKeyDict[tableName]:
             data += ( dataDict[k], )
-        self.cur.execute(f"INSERT INTO {tableName} VALUES( {self.sqlQStrings[tableName]})", data)
+        self.cur.execute(f"INSERT INTO {tableName} (jobid, {self.sqlKeyStrings[tableName]}) VALUES( {self.sqlQStrings[tableName]})", data)
 
     # table update subcommands
     def job_info(self, *, jobid:int, dataDict:dict ):
         self.insertRecord(jobid, dataDict, jobInfoTable)
     
+    def cache_info(self, *, jobid:int, dataDict:dict ):
+        self.insertRecord(jobid, dataDict, cacheInfoTable)
+
+    def reuse_info(self, *, jobid:int, reuseOf:int, dataDict:dict ):
+        # A job whose results are reused from job reuseOf gets a job_info row that
+        # points at reuseOf and copies of its result records, so queries by jobname
+        # or jobid see it like a job that ran. dataDict overrides job_info columns.
+        keys = self.sortedKeyDict[jobInfoTable]
+        row = self.cur.execute(f"SELECT {self.sqlKeyStrings[jobInfoTable]} FROM {jobInfoTable} WHERE jobid = ?",
+                               ( reuseOf, )).fetchone()
+        jobDict = dict(zip(keys, row)) if row != None else dict.fromkeys(keys, 0)
+        jobDict.update(dataDict)
+        jobDict['reuse_of'] = reuseOf
+        self.insertRecord(jobid, jobDict, jobInfoTable)
+        for table in [timingInfoTable, fileInfoTable, slurmInfoTable, confInfoTable,
+                      digestInfoTable, perfInfoTable, restartInfoTable]:
+            cols = self.sqlKeyStrings[table]
+            self.cur.execute(f"INSERT INTO {table} (jobid, {cols}) SELECT ?, {cols} FROM {table} WHERE jobid = ?",
+                             ( jobid, reuseOf ))
+
     def timing_info(self, *, jsonFile:str=None, jobpath:str, jobid:int):
         if jsonFile == None:
             jsonFile=f"{jobpath}/timing.json"
@@ -257,6 +329,113 @@ class sqldb():
             data += ( confinfo[k], )
         self.cur.execute(f"INSERT INTO {confInfoTable} VALUES( {self.sqlQStrings[confInfoTable]})", data)
 
+    # digest-info subcommand
+    def digest_info(self, *, logFile:str=None, jobpath:str, jobid:int):
+        if logFile == None:
+            logFile=f"{jobpath}/log"
+        re_digest=re.compile(r"rundigest: rank=[0-9]+ components=([0-9]+) digest=0x([0-9a-fA-F]+) events=([0-9]+)")
+        digest = 0
+        components = 0
+        events = 0
+        try:
+            with open(logFile, errors="replace") as f:
+                for line in f:
+                    m = re_digest.search(line)
+                    if m != None:
+                        components += int(m.group(1))
+                        digest = (digest + int(m.group(2), 16)) & 0xffffffffffffffff
+                        events += int(m.group(3))
+        except FileNotFoundError:
+            return
+        # components without digest reporting produce no record
+        if components == 0:
+            return
+        self.insertRecord(jobid, {
+            "digest": f"0x{digest:016x}",
+            "components": components,
+            "events": events }, digestInfoTable)
+
+    # perf-info subcommand
+    def perf_info(self, *, logFile:str=None, jobpath:str, jobid:int):
+        if logFile == None:
+            logFile=f"{jobpath}/log"
+        re_perf=re.compile(r"perfstats:((?: [a-z-]+=[0-9]+)+)")
+        totals = { "cycles" : 0, "instructions" : 0, "cache-misses" : 0, "branch-misses" : 0 }
+        threads = 0
+        try:
+            with open(logFile, errors="replace") as f:
+                for line in f:
+                    m = re_perf.search(line)
+                    if m != None:
+                        for kv in m.group(1).split():
+                            k, v = kv.split("=")
+                            if k in totals:
+                                totals[k] += int(v)
+                        threads += 1
+        except FileNotFoundError:
+            return
+        # no record when perf_event counters were unavailable
+        if threads == 0:
+            return
+        cycles = totals["cycles"]
+        instrs = totals["instructions"]
+        self.insertRecord(jobid, {
+            "threads": threads,
+            "cycles": cycles,
+            "instructions": instrs,
+            "cache_misses": totals["cache-misses"],
+            "branch_misses": totals["branch-misses"],
+            "ipc": instrs / cycles if cycles > 0 else 0.0,
+            "cache_mpki": 1000.0 * totals["cache-misses"] / instrs if instrs > 0 else 0.0 }, perfInfoTable)
+
+    # restart-info subcommand
+    def restart_info(self, *, jsonFile:str=None, logFile:str=None, jobpath:str, jobid:int, cptJobid:int, cptNum:int, cptFile:str):
+        if jsonFile == None:
+            jsonFile=f"{jobpath}/timing.json"
+        if logFile == None:
+            logFile=f"{jobpath}/log"
+        rstDict = dict.fromkeys(self.sortedKeyDict[restartInfoTable], 0)
+        rstDict["cpt_jobid"] = cptJobid
+        rstDict["cpt_num"] = cptNum
+        try:
+            with open(jsonFile) as f:
+                timing = json.load(f)["timing-info"]
+            rstDict["load_time"] = timing["max_build_time"]
+            rstDict["resume_time"] = timing["max_run_time"]
+        except (FileNotFoundError, KeyError):
+            pass
+        # every file of the checkpoint is read on restart
+        cptDir = os.path.dirname(os.path.join(jobpath, cptFile))
+        for dirpath, dirnames, filenames in os.walk(cptDir):
+            for filename in filenames:
+                rstDict["cpt_read_bytes"] += os.path.getsize(os.path.join(dirpath, filename))
+        # per-rank deserialize totals; a rank may report once per component library
+        re_cpt=re.compile(r"cptstats: rank=([0-9]+) components=([0-9]+) deser_ns=([0-9]+) deser_max_ns=([0-9]+) deser_bytes=([0-9]+)")
+        ranks = {}
+        try:
+            with open(logFile, errors="replace") as f:
+                for line in f:
+                    m = re_cpt.search(line)
+                    if m != None:
+                        r = ranks.setdefault(int(m.group(1)), [0, 0, 0, 0])
+                        r[0] += int(m.group(2))
+                        r[1] += int(m.group(3))
+                        r[2] = max(r[2], int(m.group(4)))
+                        r[3] += int(m.group(5))
+        except FileNotFoundError:
+            pass
+        if len(ranks) > 0:
+            v = ranks.values()
+            rstDict["ranks"] = len(ranks)
+            rstDict["components"] = sum([r[0] for r in v])
+            rstDict["deser_ns_max"] = max([r[1] for r in v])
+            rstDict["deser_ns_min"] = min([r[1] for r in v])
+            rstDict["deser_ns_ave"] = sum([r[1] for r in v]) / len(ranks)
+            rstDict["deser_comp_ns_max"] = max([r[2] for r in v])
+            rstDict["deser_bytes_max"] = max([r[3] for r in v])
+            rstDict["deser_bytes_total"] = sum([r[3] for r in v])
+        self.insertRecord(jobid, rstDict, restartInfoTable)
+
     # custom table
     def sdl_info(self, *, sdl_params: dict, id: int):
         self.insertRecord(id, sdl_params, sdlInfoTable)
@@ -345,6 +524,16 @@ def _slurm_info(db, args):
 def _conf_info(db, args):
     db.conf_info(jsonFile=args.jsonFile, jobpath=args.jobpath, jobid=args.jobid)
 
+def _digest_info(db, args):
+    db.digest_info(logFile=args.logFile, jobpath=args.jobpath, jobid=args.jobid)
+
+def _perf_info(db, args):
+    db.perf_info(logFile=args.logFile, jobpath=args.jobpath, jobid=args.jobid)
+
+def _restart_info(db, args):
+    db.restart_info(jsonFile=args.jsonFile, logFile=args.logFile, jobpath=args.jobpath, jobid=args.jobid,
+                    cptJobid=args.cptJobid, cptNum=args.cptNum, cptFile=args.cptFile)
+
 if __name__ == '__main__':
 
     # main parser
@@ -387,6 +576,31 @@ if __name__ == '__main__':
         parents=[parent_parser])
     parser_conf_info.set_defaults(func=_conf_info)
     parser_conf_info.add_argument("--jsonFile", type=str, help="name of JSON file [{jobpath}/config.json]")
+    # digest_info table using the simulation log
+    parser_digest_info = subparsers.add_parser(
+        'digest-info',
+        help='update digest-info table from the component digest reports in the simulation log',
+        parents=[parent_parser])
+    parser_digest_info.set_defaults(func=_digest_info)
+    parser_digest_info.add_argument("--logFile", type=str, help="name of simulation log [{jobpath}/log]")
+    # perf_info table using the simulation log
+    parser_perf_info = subparsers.add_parser(
+        'perf-info',
+        help='update perf-info table from the perfstats hardware counter reports in the simulation log',
+        parents=[parent_parser])
+    parser_perf_info.set_defaults(func=_perf_info)
+    parser_perf_info.add_argument("--logFile", type=str, help="name of simulation log [{jobpath}/log]")
+    # restart_info table using timing.json, the simulation log and the checkpoint files
+    parser_restart_info = subparsers.add_parser(
+        'restart-info',
+        help='update restart-info table for a job restarted from a checkpoint',
+        parents=[parent_parser])
+    parser_restart_info.set_defaults(func=_restart_info)
+    parser_restart_info.add_argument("--cptJobid", type=int, required=True, help="jobid of the job that wrote the checkpoint")
+    parser_restart_info.add_argument("--cptNum", type=int, default=0, help="checkpoint number [0]")
+    parser_restart_info.add_argument("--cptFile", type=str, required=True, help="checkpoint file loaded, relative to jobpath")
+    parser_restart_info.add_argument("--jsonFile", type=str, help="name of JSON file [{jobpath}/timing.json]")
+    parser_restart_info.add_argument("--logFile", type=str, help="name of simulation log [{jobpath}/log]")
 
     # validate user input
     args = parser.parse_args()
@@ -11,14 +11,19 @@
 #
 
 import argparse
+import glob
+import hashlib
 import jobutils
 import json
 import os
+import perfanalysis
 import platform
 import re
 import shutil
 import sqlutils
+import subprocess
 import sys
+import time
 
 from collections import OrderedDict
 from copy import copy
@@ -47,6 +52,10 @@ g_sbatch="sbatch --export=ALL"
 g_os_type = platform.system()
 if "Linux" in g_os_type:
     g_mpirun += " --bind-to socket"
+
+# concurrent local jobs are confined to their own cores with taskset
+g_taskset = shutil.which('taskset')
+g_mpirun_pinned = "mpirun --bind-to none"
     
 g_lid2sid = {}   # map local id to slurm id
 
@@ -80,6 +89,42 @@ def is_strict_range(s: str) -> bool:
     except (ValueError, argparse.ArgumentTypeError):
         return False
     
+def cpu_list_str(cpus: list) -> str:
+    # [0,1,2,3,8,9] -> "0-3,8-9" for taskset -c
+    spans = []
+    for c in sorted(cpus):
+        if spans and c == spans[-1][1] + 1:
+            spans[-1][1] = c
+        else:
+            spans.append([c, c])
+    return ",".join([f"{a}-{b}" if a != b else f"{a}" for a, b in spans])
+
+def file_hash(path: str) -> str:
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for block in iter(lambda: f.read(1 << 20), b""):
+            h.update(block)
+    return h.hexdigest()
+
+def components_hash(sst_params: dict) -> str:
+    # hash of the component libraries SST loads: the --add-lib-path directories, else
+    # the sst-bench build tree and the registered install directories (make install
+    # copies each library into its component source directory). None when no library is found.
+    if 'add-lib-path' in sst_params:
+        dirs = str(sst_params['add-lib-path']).split(':')
+    else:
+        dirs = [f"{g_scripts}/../build/components", f"{g_scripts}/../components"]
+    libs = []
+    for d in dirs:
+        for dirpath, dirnames, filenames in os.walk(d):
+            libs += [os.path.join(dirpath, f) for f in filenames if f.endswith(('.so', '.dylib'))]
+    if len(libs) == 0:
+        return None
+    h = hashlib.sha256()
+    for lib in sorted(libs):
+        h.update(f"{os.path.basename(lib)} {file_hash(lib)}\n".encode())
+    return h.hexdigest()
+
 def range_from_str(s: str) -> range:
     # command line range argument type
     if is_integer(s):
@@ -118,6 +163,7 @@ class JobEntry():
         self.cpt_num = 0
         self.cpt_timestamp = 0
         self.setdeps = False
+        self.friendpath = None  # run directory of a reused friend job
 
         self.sstopts = f"--num-threads={self.threads}"
         self.sstopts += f" --print-timing-info=4 --timing-info-json=timing.json"
@@ -178,6 +224,20 @@ class JobEntry():
         self.setdeps = True
     def completion(self):
         self.jtype = JobType.COMPLETION
+    def cache_key(self, sst_build:str, comp_hash:str, friend_hash:str) -> str:
+        # content hash of everything that determines the results of this job.
+        # Run specific parts of the job string (job ids, core pinning) are left out.
+        sdl_hash = file_hash(self.sdlFile) if self.sdlFile else ""
+        h = hashlib.sha256()
+        for v in [sst_build, comp_hash, self.jtype.name, self.slurm, self.ranks, self.threads, self.nodes,
+                  self.sdlFile, sdl_hash, self.sstopts, sorted(self.sdl_params.items()),
+                  self.cpt_num, self.cpt_timestamp, friend_hash]:
+            h.update(f"{v}\n".encode())
+        return h.hexdigest()
+    def reuse_friend(self, path:str):
+        # read the friend's files from its earlier run directory
+        self.friendpath = path
+        self.predecessors = []
     def getsid(self, slurm, lid, norun):
         if slurm:
             if lid in g_lid2sid:
@@ -185,7 +245,7 @@ class JobEntry():
             elif norun:
                 return f":id_{lid}" # indicate dependency but sbatch will not parse it      
         return lid
-    def getJobString(self, norun = False):
+    def getJobString(self, norun = False, cpus:list = None):
         # only called when submitting runs to ensure previous slurm ids are available
         if self.jtype == JobType.COMPLETION:
             jobstring = f"{g_sbatch} --parsable --wait --dependency=singleton --job-name={self.jobname} {g_slurm_completion} -r {g_scripts} -R {self.sim_controls['tmpdir']} -d {self.db}"
@@ -193,16 +253,21 @@ class JobEntry():
         # Parallel load
         if self.jtype == JobType.PLOAD:
             sid = self.getsid(self.slurm, self.friend, norun)
-            self.sstopts += f" ../{sid}/config.py"
+            frpath = self.friendpath if self.friendpath else f"../{sid}"
+            self.sstopts += f" {frpath}/config.py"
         # Restart
         if self.jtype == JobType.RST:
             sid = self.getsid(self.slurm, self.cptid, norun)
-            self.sstopts += f" --load-checkpoint ../{sid}/{self.cptfile}"
+            frpath = self.friendpath if self.friendpath else f"../{sid}"
+            self.sstopts += f" --load-checkpoint {frpath}/{self.cptfile}"
         sst_cmd = f"sst {self.sdlFile} {self.sstopts} {self.sdlopts}"
         # Set dependencies
         if self.slurm == False:
-            # local jobs will not be run in parallel so dependencies do not matter
-            jobstring = f"{g_mpirun} -np {self.ranks} {sst_cmd}"
+            # local dependencies are honored by JobManager.launch_local
+            if cpus:
+                jobstring = f"{g_taskset} -c {cpu_list_str(cpus)} {g_mpirun_pinned} -np {self.ranks} {sst_cmd}"
+            else:
+                jobstring = f"{g_mpirun} -np {self.ranks} {sst_cmd}"
         else:
             deps = ""
             if self.setdeps and len(self.predecessors) > 0:
@@ -216,17 +281,13 @@ class JobEntry():
 class JobManager():
     def __init__(self, sdl, options, sim_control_params, job_sequencer_params, sst_params: list, sdl_params: list ):
         print("\nCreating Job Manager")
-        # Ok to omit clocks which is used for calculating the number of checkpoints 
-        # when 'numcpt' is not set and checkpoint or restart is enabled
-        if 'clocks' in sdl_params:
-            self.clocks = clocks
-        else:
-            self.clocks = 0
-
         self.logging = options['logging']
         self.noprompt = options['noprompt']
         self.norun = options['norun']
         self.slurm = options['slurm']
+        self.cores = options['cores']
+        self.baseline = options['baseline']
+        self.force = options['force']
 
         self.db = sim_control_params['db']
         self.jobname = sim_control_params['jobname']
@@ -238,7 +299,9 @@ class JobManager():
         self.do_checkpoint = seq=='BASE_CPT' or self.do_restart
         self.do_parallel_load = seq=='BASE_PLOAD'
         self.simperiod = int(job_sequencer_params['simperiod'])
-        self.numcpt = int(job_sequencer_params['numcpt']) 
+        self.numcpt = int(job_sequencer_params['numcpt'])
+        self.rstselect = job_sequencer_params['rstselect']
+        self.rstPending = {}  # CPT id -> base entry for restart jobs
 
         self.sst_params = copy(sst_params)
         self.sdl_params = copy(sdl_params)
@@ -246,6 +309,8 @@ class JobManager():
         self.next_id = g_id_base
         self.joblist = OrderedDict()
         self.wipList = []
+        self.doneList = []
+        self.failedList = []  # failed and skipped local jobs
         self.jutil = jobutils.JobUtil("jutil")
         # determine unique job name for run directory
         rdir=f"{self.tmpdir}/{self.jobname}"
@@ -261,6 +326,22 @@ class JobManager():
         # print(f"{g_pfx} Jobs will run in: {self.rundir}")
         # database
         self.sqldb = sqlutils.sqldb(self.db, self.sdl_params, self.logging)
+        # result cache: hash -> (jobid, jobpath) of earlier successful jobs
+        self.cache = {}
+        for jobid, h, jobpath in self.sqldb.cur.execute("SELECT jobid, hash, jobpath FROM cache_info ORDER BY jobid"):
+            self.cache[h] = (jobid, jobpath)
+        self.hashes = {}   # id -> hash
+        self.reused = {}   # id -> (jobid, jobpath) of reused results
+        self.jobSstParams = {}  # jobid -> sst parameters of completed jobs
+        self.sst_version = None
+        self.sst_build = None
+        self.comp_hash = components_hash(self.sst_params)
+        if self.comp_hash == None:
+            print(f"{g_pfx} warning: no component libraries found to hash; result caching is disabled for this run")
+        # a regression check must time every job, so results are recorded but not reused
+        self.reuse_ok = self.baseline == None
+        if self.comp_hash != None and not self.reuse_ok:
+            print(f"{g_pfx} results of earlier jobs are not reused when checking against a baseline")
     def add_job(self, entry:JobEntry):
         id = self.next_id
         self.joblist[id] = entry
@@ -274,23 +355,11 @@ class JobManager():
             cptEntry=copy(baseEntry)
             cptEntry.cpt(self.simperiod, id_base)
             id_cpt = jobmgr.add_job(cptEntry)
-            # estimate number of checkpoints (TODO move to args validation)
-            numCpts = self.numcpt
-            if numCpts == 0:
-                numCpts = int(self.clocks / self.simperiod)
-            # predict checkpoint file names for restart
-            period = int(self.simperiod * 1000) # ns to ps
-            timestamp = (numCpts+1) * period
-            # add restart jobs
+            # restart jobs are added once the checkpoint job has completed
             if self.do_restart:
-                # schedule shortest restart runs first 
-                for n in range(numCpts, 0, -1):
-                    timestamp = timestamp - period
-                    # TODO use a generic name
-                    cpt = f"{g_cptpfx}/{n}_{timestamp}/sweeper.sstcpt"
-                    rstEntry = copy(baseEntry)
-                    rstEntry.rst(id_cpt, cpt, n, timestamp)
-                    jobmgr.add_job(rstEntry)
+                self.rstPending[id_cpt] = copy(baseEntry)
+                if self.norun:
+                    print(f"{g_pfx} restart jobs for checkpoint job {id_cpt} are scheduled from its checkpoint files")
         # add parallel load job
         if self.do_parallel_load:
             ploadEntry=copy(baseEntry)
@@ -301,7 +370,97 @@ class JobManager():
             compEntry=copy(baseEntry)
             compEntry.completion()
             jobmgr.add_job(compEntry)
+    def find_checkpoints(self, cptdir:str) -> list:
+        # [(cpt_num, cpt_timestamp, path relative to the job directory)] in checkpoint order
+        re_cpt = re.compile(f"^{g_cptpfx}/([0-9]+)_([0-9]+)/[^/]+\\.sstcpt$")
+        cpts = []
+        for f in glob.glob(f"{cptdir}/{g_cptpfx}/*/*.sstcpt"):
+            rel = os.path.relpath(f, cptdir)
+            m = re_cpt.match(rel)
+            if m != None:
+                cpts.append((int(m.group(1)), int(m.group(2)), rel))
+        return sorted(cpts)
+    def select_checkpoints(self, cpts:list) -> list:
+        # numcpt checkpoints chosen by rstselect; all when numcpt is 0
+        n = self.numcpt
+        if n == 0 or n >= len(cpts):
+            return cpts
+        if self.rstselect == 'first':
+            return cpts[:n]
+        if self.rstselect == 'last':
+            return cpts[-n:]
+        # even: spaced across the run, always including the last checkpoint
+        if n == 1:
+            return cpts[-1:]
+        return [cpts[round(i * (len(cpts) - 1) / (n - 1))] for i in range(n)]
+    def schedule_restarts(self, *, id:int, cptdir:str, friendpath:str=None):
+        # discover the checkpoints written by CPT job `id` and add its restart jobs
+        if id not in self.rstPending:
+            return
+        baseEntry = self.rstPending.pop(id)
+        cpts = self.find_checkpoints(cptdir)
+        if len(cpts) == 0:
+            print(f"{g_pfx} warning: checkpoint job {id} wrote no checkpoints in {cptdir}/{g_cptpfx}")
+            return
+        selected = self.select_checkpoints(cpts)
+        print(f"{g_pfx} checkpoint job {id} wrote {len(cpts)} checkpoints; restarting from {[c[0] for c in selected]}")
+        # schedule shortest restart runs first, ahead of the remaining jobs
+        pending = self.joblist
+        self.joblist = OrderedDict()
+        for n, timestamp, cpt in reversed(selected):
+            rstEntry = copy(baseEntry)
+            rstEntry.rst(id, cpt, n, timestamp)
+            if friendpath:
+                rstEntry.reuse_friend(friendpath)
+            self.add_job(rstEntry)
+        self.joblist.update(pending)
+    def get_sst_version(self) -> str:
+        if self.sst_version == None:
+            sst_version_match=re.search(r'SST-Core Version \((.+)[,\)]?.+$', self.get_sst_build())
+            if sst_version_match:
+                self.sst_version=sst_version_match.group(1).split(',')[0]
+            else:
+                self.sst_version="?"
+        return self.sst_version
+    def get_sst_build(self) -> str:
+        # the full version report: development builds add the core branch and commit
+        if self.sst_build == None:
+            self.jutil.exec(cmd='sst --version')
+            self.sst_build = str(self.jutil.res1)
+        return self.sst_build
+    def reuse(self, *, id:int, entry:JobEntry) -> bool:
+        # True when the results of an identical earlier job are reused instead of running it
+        if entry.jtype == JobType.COMPLETION or self.comp_hash == None:
+            return False
+        friend_hash = self.hashes.get(entry.friend, "") if entry.jtype in (JobType.RST, JobType.PLOAD) else ""
+        h = entry.cache_key(self.get_sst_build(), self.comp_hash, friend_hash)
+        self.hashes[id] = h
+        if self.force or not self.reuse_ok or h not in self.cache:
+            return False
+        jobid, jobpath = self.cache[h]
+        # checkpoints and configurations read by later jobs must still exist
+        ploads = [e for e in self.joblist.values() if e.jtype == JobType.PLOAD and e.friend == id]
+        if ( id in self.rstPending or len(ploads) > 0 ) and not os.path.isdir(jobpath):
+            return False
+        print(f"{g_pfx} job {id} reusing results of job {jobid} in {jobpath}")
+        self.reused[id] = (jobid, jobpath)
+        self.doneList.append(id)
+        self.jobSstParams[id] = entry.sst_params
+        # rows under this sweep's jobname pointing at the earlier job
+        self.sqldb.sdl_info(id=id, sdl_params=entry.sdl_params)
+        self.sqldb.reuse_info(jobid=id, reuseOf=jobid, dataDict={
+            "jobname": entry.jobname,
+            "friend": self.friend_jobid(entry),
+            "date":  datetime.now().strftime("%Y.%m.%d %H:%M") })
+        self.sqldb.commit()
+        for e in ploads:
+            e.reuse_friend(jobpath)
+        if entry.jtype == JobType.CPT:
+            self.schedule_restarts(id=id, cptdir=jobpath, friendpath=jobpath)
+        return True
     def run(self, *, id:int, entry:JobEntry):
+        if self.reuse(id=id, entry=entry):
+            return
         jobstr = entry.getJobString(self.norun)
         print(f"{g_pfx} job {id} {jobstr}")
         if self.norun:
@@ -320,31 +479,40 @@ class JobManager():
             cwd=f"{self.rundir}/{id}"
             rc = self.jutil.exec(cmd=jobstr, cwd=cwd, log="log")
             jobid = id
-
+        self.record(id=id, jobid=jobid, entry=entry, jobstr=jobstr, cwd=cwd, ok=rc==0)
+    def friend_jobid(self, entry:JobEntry):
+        # reused jobs have rows under their local id
+        if self.slurm and entry.friend in g_lid2sid:
+            return g_lid2sid[entry.friend]
+        return entry.friend
+    def record(self, *, id:int, jobid, entry:JobEntry, jobstr:str, cwd:str, ok:bool=True):
         # Post-processing: Final table updates 
         # Any records using local ids need to be converted to remote for slurm job
         # (jobid already is)
-        friend = entry.friend
-        if self.slurm and friend in g_lid2sid:
-            friend = g_lid2sid[entry.friend]
+        friend = self.friend_jobid(entry)
+        jobpath = f"{self.tmpdir}/{self.jobname}/{jobid}" if self.slurm else cwd
 
         # keep track of jobs up to completion job then run post-processing
         self.wipList.append(jobid)
+        if entry.jtype != JobType.COMPLETION and ok:
+            self.doneList.append(jobid)
+            self.jobSstParams[jobid] = entry.sst_params
         # Capture set up parameters here
         self.sqldb.sdl_info(id=jobid, sdl_params=entry.sdl_params)
+        # Restart breakdown keyed to the checkpoint job
+        if entry.jtype == JobType.RST and ok:
+            frpath = entry.friendpath if entry.friendpath else f"../{friend}"
+            self.sqldb.restart_info(jobpath=jobpath, jobid=jobid, cptJobid=friend,
+                                    cptNum=entry.cpt_num, cptFile=f"{frpath}/{entry.cptfile}")
+        # failed jobs keep their job_info row but have no results to post-process
         if self.slurm == False:
-            self.pp_local(id=jobid, cwd=cwd)
+            if ok:
+                self.pp_local(id=jobid, cwd=cwd)
         elif entry.jtype==JobType.COMPLETION:
             self.pp_remote(comp_id=jobid)
 
         # sst version
-        self.jutil.exec(cmd='sst --version')
-        sst_version_string = self.jutil.res1
-        sst_version_match=re.search(r'SST-Core Version \((.+)[,\)]?.+$', sst_version_string)
-        if sst_version_match:
-            sst_version=sst_version_match.group(1).split(',')[0]
-        else:
-            sst_version="?"
+        sst_version = self.get_sst_version()
 
         self.sqldb.job_info( jobid=jobid, dataDict={
             "jobname": entry.jobname,
@@ -359,9 +527,23 @@ class JobManager():
             "cwd": cwd,
             "sst_version": sst_version,
             "os_type": g_os_type,
-            "date":  datetime.now().strftime("%Y.%m.%d %H:%M") 
+            "date":  datetime.now().strftime("%Y.%m.%d %H:%M"),
+            "reuse_of": 0
         } )
+        # successful jobs are reused by later sweeps with identical settings
+        if ok and id in self.hashes:
+            self.sqldb.cache_info(jobid=jobid, dataDict={
+                "hash": self.hashes[id],
+                "jobtype": entry.jtype.name,
+                "jobpath": jobpath })
+            self.cache[self.hashes[id]] = (jobid, jobpath)
         self.sqldb.commit()
+        if entry.jtype == JobType.CPT:
+            if ok:
+                self.schedule_restarts(id=id, cptdir=jobpath)
+            elif id in self.rstPending:
+                del self.rstPending[id]
+                print(f"{g_pfx} skipping the restart jobs of failed checkpoint job {id}")
     def launch(self):
         print(f"\n{g_pfx} starting {len(self.joblist)} jobs in {self.rundir}")
         if self.noprompt == False:
@@ -370,16 +552,143 @@ class JobManager():
             if resp != "Y" and resp != "y":
                 print("exiting...")
                 sys.exit(0)
+        if self.cores > 0 and not self.slurm and not self.norun:
+            self.launch_local()
+            return
         while len(self.joblist)>0:
             j=self.joblist.popitem(False)
             self.run(id=j[0], entry=j[1])
+    def launch_local(self):
+        # Run local jobs concurrently within a budget of self.cores cores.
+        # A job starts once its predecessors have completed and enough cores
+        # are free; each job is pinned to its own set of ranks*threads cores.
+        # Later jobs that fit may start ahead of a larger job waiting for cores.
+        cpus = sorted(os.sched_getaffinity(0)) if hasattr(os, "sched_getaffinity") else list(range(os.cpu_count()))
+        free = cpus[:self.cores]
+        budget = len(free)
+        pin = g_taskset != None
+        print(f"{g_pfx} running local jobs concurrently on {budget} cores{'' if pin else ' (taskset not found, jobs not pinned)'}")
+        done = set()
+        failed = set()  # failed and skipped jobs; their dependents are skipped
+        skipped = []
+        running = {}  # id -> (process, log, entry, jobstr, cwd, cores)
+        while len(self.joblist) > 0 or len(running) > 0:
+            progress = False
+            for id, entry in list(self.joblist.items()):
+                bad = [p for p in entry.predecessors if p in failed]
+                if len(bad) > 0:
+                    print(f"{g_pfx} skipping job {id}: predecessor job {bad[0]} failed")
+                    del self.joblist[id]
+                    failed.add(id)
+                    skipped.append(id)
+                    progress = True
+                    continue
+                if any(p not in done for p in entry.predecessors):
+                    continue
+                if self.reuse(id=id, entry=entry):
+                    del self.joblist[id]
+                    done.add(id)
+                    progress = True
+                    continue
+                need = entry.procs
+                if need > budget:
+                    # oversized jobs run alone on every core in the budget
+                    if len(running) > 0:
+                        continue
+                    need = budget
+                if need > len(free):
+                    continue
+                cores = free[:need]
+                free = free[need:]
+                del self.joblist[id]
+                progress = True
+                jobstr = entry.getJobString(self.norun, cores if pin else None)
+                cwd = f"{self.rundir}/{id}"
+                print(f"{g_pfx} job {id} {jobstr}")
+                os.makedirs(cwd, exist_ok=True)
+                log = open(f"{cwd}/log", "w")
+                try:
+                    proc = subprocess.Popen(jobstr.split(), cwd=cwd, stdout=log, encoding='utf-8')
+                except FileNotFoundError as e:
+                    print(f"{g_pfx} error: {jobstr} : {e.strerror}")
+                    log.close()
+                    free = sorted(free + cores)
+                    failed.add(id)
+                    self.record(id=id, jobid=id, entry=entry, jobstr=jobstr, cwd=cwd, ok=False)
+                    continue
+                running[id] = (proc, log, entry, jobstr, cwd, cores)
+            finished = [id for id in running if running[id][0].poll() != None]
+            if len(finished) == 0:
+                if len(running) == 0 and not progress:
+                    print(f"{g_pfx} error: {len(self.joblist)} jobs have unresolved predecessors")
+                    sys.exit(1)
+                if len(running) > 0:
+                    time.sleep(0.5)
+                continue
+            for id in finished:
+                proc, log, entry, jobstr, cwd, cores = running.pop(id)
+                log.close()
+                if proc.returncode != 0:
+                    print(f"{g_pfx} error: job {id} returned {proc.returncode}")
+                    failed.add(id)
+                else:
+                    done.add(id)
+                free = sorted(free + cores)
+                self.record(id=id, jobid=id, entry=entry, jobstr=jobstr, cwd=cwd, ok=proc.returncode==0)
+        if len(failed) > 0:
+            print(f"{g_pfx} error: {len(failed) - len(skipped)} jobs failed; skipped dependent jobs {skipped}")
+        self.failedList = sorted(failed)
     def pp_local(self, *, id:int, cwd:str):
         # print(f"{g_pfx} pp_local {id} {cwd}")
         self.wipList = []
         self.sqldb.file_info(jobid=id, jobpath=cwd)
         self.sqldb.timing_info(jobid=id, jobpath=cwd)
         self.sqldb.conf_info(jobid=id, jobpath=cwd)
+        self.sqldb.digest_info(jobid=id, jobpath=cwd)
+        self.sqldb.perf_info(jobid=id, jobpath=cwd)
         self.sqldb.commit()
+    def check_digests(self) -> int:
+        # Jobs with identical sdl and sst parameters must report identical run digests
+        # regardless of ranks, threads, checkpoint/restart or parallel load
+        if self.norun or len(self.doneList) == 0:
+            return 0
+        ids = ','.join([str(i) for i in self.doneList])
+        cur = self.sqldb.cur
+        try:
+            rows = cur.execute(
+                f"SELECT D.jobid, J.jobtype, D.digest, S.* FROM digest_info D "
+                f"JOIN job_info J ON J.jobid = D.jobid "
+                f"JOIN sdl_info S ON S.jobid = D.jobid "
+                f"WHERE D.jobid IN ({ids}) ORDER BY D.jobid").fetchall()
+        except Exception as e:
+            print(f"{g_pfx} digest check skipped: {e}")
+            return 0
+        if len(rows) == 0:
+            print(f"{g_pfx} warning: digest check skipped, no run digests were reported by {len(self.doneList)} jobs")
+            return 0
+        groups = OrderedDict()
+        for row in rows:
+            # row = jobid, jobtype, digest, sdl jobid, sdl params...
+            sst_params = sorted(self.jobSstParams.get(row[0], {}).items())
+            key = tuple(row[4:]) + tuple(sst_params)
+            groups.setdefault(key, {}).setdefault(row[2], []).append(f"{row[0]}({row[1]})")
+        mismatches = 0
+        for key, digests in groups.items():
+            if len(digests) > 1:
+                mismatches += 1
+                print(f"{g_pfx} error: run digest mismatch for sdl and sst parameters {key}")
+                for digest, jobs in digests.items():
+                    print(f"{g_pfx}    {digest} : {' '.join(jobs)}")
+        print(f"{g_pfx} digest check: {len(rows)} jobs in {len(groups)} configurations, {mismatches} mismatched")
+        return mismatches
+    def check_baseline(self) -> int:
+        # Regression check of the completed jobs against a perfanalysis.py baseline
+        if self.baseline == None or self.norun or len(self.doneList) == 0:
+            return 0
+        pdb = perfanalysis.perfdb(self.db, jobids=self.doneList)
+        regressions = pdb.compare(baselineFile=self.baseline, overrides={})
+        pdb.close()
+        return regressions
     def pp_remote(self, comp_id:int):
         sacct_ok = g_sacct == None
         if sacct_ok == True:
@@ -405,6 +714,10 @@ class JsonParams():
         self.errors = []
         self.sweep_required = ['name', 'desc', 'ranks', 'threadsPerRank']
         self.sweep_optional = ['depvar', 'sdl']
+        self.job_sequencer_optional = {
+            'numcpt'    : ['0', 'Number of discovered checkpoints to restart from. When 0, all'],
+            'rstselect' : ['first', 'Checkpoints restarted when numcpt limits the count: first|last|even']
+        }
         self.sst_reserved = ['num-threads', 'output-json', 'print-timing-info', 'timing-info-json']
         self.re_env_var = r"\$\{.+?}"
         if jsonFile == None:
@@ -519,6 +832,8 @@ class JsonParams():
             if key in self.json[group]:
                 if len(self.json[group][key])==2:
                     return f"[{self.json[group][key][0]}]" # default help value string
+            elif group == 'job_sequencer' and key in self.job_sequencer_optional:
+                return f"[{self.job_sequencer_optional[key][0]}]"
         self.errors.append(f"error: problem with json.{group}.{key}")
         return f"[???]"
     def parse_env_vars(self, obj):
@@ -575,6 +890,12 @@ if __name__ == '__main__':
                                help=f"print job commands but do not run" )
     parser.add_argument("--slurm", action="store_true",
                                help=f"launch slurm jobs instead of using local mpirun")
+    parser.add_argument("--cores", type=int, default=0,
+                               help=f"run local jobs concurrently, pinned to disjoint sets of ranks*threads cores\nwithin a budget of CORES cores [0: one job at a time]")
+    parser.add_argument("--force", action="store_true",
+                               help=f"run every job even when results of an identical job are already in the database")
+    parser.add_argument("--baseline", type=str,
+                               help=f"perfanalysis.py baseline json file; exit with an error on performance regressions")
 
     # "job_sequencer" overrides
     job_seq_group = parser.add_argument_group('job sequencer overrides')
@@ -584,7 +905,10 @@ if __name__ == '__main__':
     job_seq_group.add_argument("--simperiod", type=int, 
                                help=f"checkpoint simulation period in ns {jsonParams.defv_str('job_sequencer', 'simperiod')}")
     job_seq_group.add_argument("--numcpt", type=int, 
-                               help=f"Estimated number of checkpoints. When 0, calculated by sdl.clocks/simperiod {jsonParams.defv_str('job_sequencer', 'numcpt')}")
+                               help=f"Number of discovered checkpoints to restart from. When 0, all {jsonParams.defv_str('job_sequencer', 'numcpt')}")
+    ALLOWED_RSTSELECT = ['first', 'last', 'even']
+    job_seq_group.add_argument("--rstselect", type=str, choices=ALLOWED_RSTSELECT,
+                               help=f"Checkpoints restarted when numcpt limits the count {jsonParams.defv_str('job_sequencer', 'rstselect')}")
 
     
     # "sim_control" overrides
@@ -651,7 +975,10 @@ if __name__ == '__main__':
         'logging' : args.logging,
         'noprompt' : args.noprompt,
         'norun' : args.norun,
-        'slurm' : args.slurm
+        'slurm' : args.slurm,
+        'cores' : args.cores,
+        'force' : args.force,
+        'baseline' : args.baseline
     }
 
     #
@@ -679,8 +1006,11 @@ if __name__ == '__main__':
 
     print("\n[resolved job_sequencer parameters]")
     job_sequencer_params = {}
-    for key in jsonParams.job_sequencer_params:
-        val = jsonParams.job_sequencer_params[key][0]
+    for key in list(jsonParams.job_sequencer_params) + [k for k in jsonParams.job_sequencer_optional if k not in jsonParams.job_sequencer_params]:
+        if key in jsonParams.job_sequencer_params:
+            val = jsonParams.job_sequencer_params[key][0]
+        else:
+            val = jsonParams.job_sequencer_optional[key][0]
         if key in args_dict and args_dict[key] != None:
             val = args_dict[key]
         job_sequencer_params[key] = val
@@ -723,6 +1053,20 @@ if __name__ == '__main__':
     #
     if job_sequencer_params['seq'] not in ALLOWED_SEQ:
         print(f"error: job_sequencer.seq must be in [{'|'.join(ALLOWED_SEQ)}]")
+    if args.cores < 0:
+        print("error: cores must be 0 or greater")
+        sys.exit(1)
+    if int(job_sequencer_params['numcpt']) < 0:
+        print("error: numcpt must be 0 or greater")
+        sys.exit(1)
+    if job_sequencer_params['rstselect'] not in ALLOWED_RSTSELECT:
+        print(f"error: job_sequencer.rstselect must be in [{'|'.join(ALLOWED_RSTSELECT)}]")
+        sys.exit(1)
+    if args.baseline != None:
+        if not os.path.isfile(args.baseline):
+            print(f"error: could not find baseline file {args.baseline}")
+            sys.exit(1)
+        options['baseline'] = os.path.abspath(args.baseline)
     simperiod = int(job_sequencer_params['simperiod'])
     if simperiod <= 0:
         print("error: simperiod must be greater than 0")
@@ -829,3 +1173,14 @@ if __name__ == '__main__':
     
     # Launch from job manager
     jobmgr.launch()
+
+    # Verify determinism across ranks, threads, checkpoints and parallel load
+    if jobmgr.check_digests() > 0:
+        sys.exit(1)
+
+    # Compare against the stored performance baseline
+    if jobmgr.check_baseline() > 0:
+        sys.exit(1)
+
+    if len(jobmgr.failedList) > 0:
+        sys.exit(1)
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tdbg-reader.py
+#
+# Reads the ./<component>.tdbg and ./tcldbg-rank<n>.tdbg files written by
+# tcldbg.TclDbg with dumpMode=mmap or dumpMode=delta and reconstructs the
+# data vector of one component at a dumped cycle, or with --compare checks
+# that two files hold the same state at every cycle dumped to both, e.g. the
+# mmap and delta components of test/tcl-dbg/tcldbg-test3.py. Record layout (little
+# endian, unaligned):
+#
+#   header : uint32 magic, uint32 kind, uint64 comp, uint64 cycle, uint64 count
+#   FULL   : count * uint32
+#   DELTA  : uint64 nranges, nranges * (uint64 start, uint64 len, len * uint32)
+#
+# A file left by an unfinished run is zero padded to the mapping size; the
+# scan stops at the first header without the magic.
+#
+
+import argparse
+import array
+import struct
+import sys
+
+DUMP_MAGIC = 0x47424454
+DUMP_FULL  = 0
+DUMP_DELTA = 1
+
+HDR = struct.Struct("<IIQQQ")
+U64 = struct.Struct("<Q")
+RNG = struct.Struct("<QQ")
+
+def words(buf, off, n):
+    # n uint32 values starting at byte offset off
+    a = array.array("I")
+    a.frombytes(buf[off:off + 4 * n])
+    if sys.byteorder != "little":
+        a.byteswap()
+    return a
+
+def records(buf):
+    # yields (offset, kind, comp, cycle, count, payload offset, record bytes)
+    off = 0
+    while off + HDR.size <= len(buf):
+        magic, kind, comp, cycle, count = HDR.unpack_from(buf, off)
+        if magic != DUMP_MAGIC:
+            return
+        pos = off + HDR.size
+        if kind == DUMP_FULL:
+            end = pos + 4 * count
+        elif kind == DUMP_DELTA:
+            (nranges,) = U64.unpack_from(buf, pos)
+            end = pos + U64.size
+            for _ in range(nranges):
+                start, n = RNG.unpack_from(buf, end)
+                end += RNG.size + 4 * n
+        else:
+            sys.exit(f"error: unknown record kind {kind} at offset {off}")
+        if end > len(buf):
+            sys.exit(f"error: truncated record at offset {off}")
+        yield (off, kind, comp, cycle, count, pos, end - off)
+        off = end
+
+def apply(buf, state, kind, count, pos):
+    # returns the state after applying one record
+    if kind == DUMP_FULL:
+        return words(buf, pos, count)
+    if state is None:
+        sys.exit("error: delta record before the first keyframe")
+    if len(state) != count:
+        sys.exit(f"error: delta record resizes data from {len(state)} to {count}")
+    (nranges,) = U64.unpack_from(buf, pos)
+    pos += U64.size
+    for _ in range(nranges):
+        start, n = RNG.unpack_from(buf, pos)
+        pos += RNG.size
+        state[start:start + n] = words(buf, pos, n)
+        pos += 4 * n
+    return state
+
+def states(buf, comp):
+    # yields (cycle, state) after each record of one component
+    state = None
+    for off, kind, c, cycle, count, pos, nbytes in records(buf):
+        if c != comp:
+            continue
+        state = apply(buf, state, kind, count, pos)
+        yield (cycle, state)
+
+def select_comp(buf, comp, file):
+    # the requested component, or the only component in the file
+    if comp is not None:
+        return comp
+    comps = sorted(set(r[2] for r in records(buf)))
+    if len(comps) > 1:
+        sys.exit(f"error: {len(comps)} components in {file}; select one with --comp {comps}")
+    return comps[0] if comps else 0
+
+def compare(buf, comp, other, otherComp):
+    # number of cycles dumped to both files; exits on the first mismatch
+    matched = 0
+    it = states(other, otherComp)
+    ocycle, ostate = next(it, (None, None))
+    for cycle, state in states(buf, comp):
+        while ocycle is not None and ocycle < cycle:
+            ocycle, ostate = next(it, (None, None))
+        if ocycle != cycle:
+            continue
+        if state != ostate:
+            sys.exit(f"error: states differ at cycle {cycle}")
+        matched += 1
+    return matched
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="reconstruct tcldbg.TclDbg state from a .tdbg dump file")
+    parser.add_argument("file", type=str, help="dump file written by dumpMode=mmap or dumpMode=delta")
+    parser.add_argument("--comp", type=int, help="component id; required when the file holds several components")
+    parser.add_argument("--cycle", type=int, help="reconstruct at the last dump at or before this cycle [last dump]")
+    parser.add_argument("--list", action="store_true", help="list the records and exit")
+    parser.add_argument("--out", type=str, help="write the reconstructed values to this file, one per line")
+    parser.add_argument("--compare", type=str, help="check the states of a second dump file at every cycle dumped to both")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as fd:
+        buf = fd.read()
+
+    if args.compare:
+        with open(args.compare, "rb") as fd:
+            other = fd.read()
+        matched = compare(buf, select_comp(buf, args.comp, args.file),
+                          other, select_comp(other, None, args.compare))
+        if matched == 0:
+            sys.exit(f"error: no cycle is dumped to both {args.file} and {args.compare}")
+        print(f"{matched} cycles match")
+        sys.exit(0)
+
+    if args.list:
+        print("offset,kind,comp,cycle,count,bytes")
+        for off, kind, comp, cycle, count, pos, nbytes in records(buf):
+            print(f"{off},{'FULL' if kind == DUMP_FULL else 'DELTA'},{comp},{cycle},{count},{nbytes}")
+        sys.exit(0)
+
+    args.comp = select_comp(buf, args.comp, args.file)
+
+    state = None
+    at = None
+    for off, kind, comp, cycle, count, pos, nbytes in records(buf):
+        if comp != args.comp:
+            continue
+        if args.cycle is not None and cycle > args.cycle:
+            break
+        state = apply(buf, state, kind, count, pos)
+        at = cycle
+
+    if state is None:
+        sys.exit("error: no dump at or before the requested cycle")
+    if args.cycle is not None and at != args.cycle:
+        print(f"note: no dump at cycle {args.cycle}; using cycle {at}", file=sys.stderr)
+
+    print(f"comp={args.comp} cycle={at} count={len(state)}")
+    if args.out:
+        with open(args.out, "w") as fd:
+            for v in state:
+                fd.write(f"{v}\n")
+
+# EOF
@@ -16,6 +16,11 @@ c0.addParams({
   "verbose" : 0,
   "numStats" : 100,
   "numClocks" : 100000,
+  "dumpPeriod" : 25000,
 })
 
+sst.setStatisticLoadLevel(10)
+sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./large-stat-chkpnt-test1.csv"})
+sst.enableAllStatisticsForAllComponents()
+
 # EOF
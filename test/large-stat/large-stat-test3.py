@@ -0,0 +1,40 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# large-stat-test3.py
+#
+# Exercises each sampling mode against accumulator, histogram and
+# unique-count statistics with periodic statistic dumps
+#
+
+import os
+import sst
+
+modes = ["all", "random", "roundrobin"]
+for i in range(len(modes)):
+  c = sst.Component("c" + str(i), "largestat.LargeStat")
+  c.addParams({
+    "verbose" : 1,
+    "numStats" : 100,
+    "numClocks" : 1000,
+    "sampleMode" : modes[i],
+    "samplesPerTick" : 10,
+    "dumpPeriod" : 250,
+  })
+
+sst.setStatisticLoadLevel(10)
+sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./large-stat-test3.csv"})
+sst.enableStatisticForComponentName("c0", "STAT_", {"type" : "sst.AccumulatorStatistic"})
+sst.enableStatisticForComponentName("c1", "STAT_",
+                                    {"type" : "sst.HistogramStatistic",
+                                     "minvalue" : "0",
+                                     "binwidth" : "64",
+                                     "numbins"  : "16",
+                                     "IncludeOutOfBounds" : "1"})
+sst.enableStatisticForComponentName("c2", "STAT_", {"type" : "sst.UniqueCountStatistic"})
+
+# EOF
@@ -0,0 +1,46 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# large-stat-test4.py
+#
+# Exercises lazy and vector statistic registration
+#
+
+import os
+import sst
+
+lazy = sst.Component("lazy", "largestat.LargeStat")
+lazy.addParams({
+  "verbose" : 1,
+  "numStats" : 1000,
+  "numClocks" : 100,
+  "sampleMode" : "random",
+  "samplesPerTick" : 2,
+  "registerMode" : "lazy",
+})
+
+vec = sst.Component("vec", "largestat.LargeStat")
+vec.addParams({
+  "verbose" : 1,
+  "numStats" : 1000,
+  "numClocks" : 100,
+  "sampleMode" : "roundrobin",
+  "samplesPerTick" : 10,
+  "registerMode" : "vector",
+})
+
+sst.setStatisticLoadLevel(10)
+sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./large-stat-test4.csv"})
+sst.enableStatisticForComponentName("lazy", "STAT_")
+sst.enableStatisticForComponentName("vec", "STAT_VEC",
+                                    {"type" : "sst.HistogramStatistic",
+                                     "minvalue" : "0",
+                                     "binwidth" : "1",
+                                     "numbins"  : "1000",
+                                     "IncludeOutOfBounds" : "0"})
+
+# EOF
@@ -0,0 +1,29 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# micro-comp-test3.py
+#
+# Exercises multiple clock domains, per-tick work and clock suspend/resume
+#
+
+import os
+import sst
+
+for i in range(4):
+  comp = sst.Component("c_" + str(i), "microcomp.MicroComp")
+  comp.addParams({
+    "verbose" : 1,
+    "numCycles" : 1000,
+    "numClocks" : 3,
+    "clockFreq" : "1GHz",
+    "workNs" : 10 * i,
+    "workBytes" : 4096,
+    "suspendInterval" : 100,
+    "suspendCycles" : 25
+  })
+
+# EOF
@@ -0,0 +1,39 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# micro-comp-test4.py
+#
+# Exercises the component footprint parameters
+#
+
+import os
+import sst
+
+numComps = 4
+ports = 4
+comps = []
+for i in range(numComps):
+  comp = sst.Component("c_" + str(i), "microcomp.MicroComp")
+  comp.addParams({
+    "verbose" : 1,
+    "stateBytes" : 65536,
+    "numPorts" : ports,
+    "numStats" : 8
+  })
+  comps.append(comp)
+
+for i in range(numComps):
+  for p in range(int(ports/2)):
+    link = sst.Link("link_c" + str(i) + "p" + str(p))
+    link.connect( (comps[i], "port" + str(p), "1ns"),
+                  (comps[(i+1) % numComps], "port" + str(p + int(ports/2)), "1ns") )
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./micro-comp-test4.csv"})
+sst.enableAllStatisticsForComponentType("microcomp.MicroComp")
+
+# EOF
@@ -0,0 +1,33 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# restore-test2.py
+#
+# Checkpoint timing statistics: components with different state sizes
+# report CPT_SER_NS/CPT_SER_BYTES per checkpoint and CPT_DESER_NS/
+# CPT_DESER_BYTES after a restart.
+#
+
+import os
+import sst
+
+sizes = [ "64KiB", "256KiB", "1MiB", "4MiB" ]
+for i, size in enumerate(sizes):
+  comp = sst.Component("rp" + str(i), "restore.Restore")
+  comp.addParams({
+    "verbose" : 0,
+    "numBytes" : size,
+    "clocks" : 10000,
+    "rngSeed" : 1223 + i,
+    "clockFreq" : "1Ghz"
+  })
+
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./restore-test2.csv"})
+sst.enableAllStatisticsForAllComponents()
+
+# EOF
@@ -19,7 +19,8 @@ cp0.addParams({
   "clockDelay" : 10,
   "clocks" : 10000000,
   "rngSeed" : 1223,
-  "clockFreq" : "1Ghz"
+  "clockFreq" : "1Ghz",
+  "dumpPeriod" : 1000000
 })
 
 cp1 = sst.Component("t1", "tcldbg.TclDbg")
@@ -30,7 +31,8 @@ cp1.addParams({
   "clockDelay" : 10,
   "clocks" : 10000000,
   "rngSeed" : 1227,
-  "clockFreq" : "1Ghz"
+  "clockFreq" : "1Ghz",
+  "dumpPeriod" : 1000000
 })
 
 #sst.enableAllStatisticsForComponentType("tcldbg.TclDbg",
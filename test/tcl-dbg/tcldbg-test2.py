@@ -0,0 +1,50 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tcldbg-test2.py
+#
+# One component per dump mode, each dumping every dumpPeriod cycles.
+# Compare the statTiming histograms across sync, async and mmap. Each
+# component reports its completed dumps at finish. The three components
+# together run fewer clocks than the two of tcldbg-test1.
+#
+
+import sst
+
+seed = 1223
+for mode in ["sync", "async", "mmap"]:
+  comp = sst.Component(mode, "tcldbg.TclDbg")
+  comp.addParams({
+    "verbose" : 5,
+    "minData" : 1,
+    "maxData" : 10000,
+    "clockDelay" : 10,
+    "clocks" : 5000000,
+    "rngSeed" : seed,
+    "clockFreq" : "1Ghz",
+    "dumpMode" : mode,
+    "dumpPeriod" : 500000
+  })
+  seed = seed + 4
+
+sst.setStatisticLoadLevel(10)
+sst.setStatisticOutput("sst.statOutputCSV")
+sst.enableStatisticForComponentType("tcldbg.TclDbg",
+    "statBytes",
+        {"type":"sst.HistogramStatistic",
+         "minvalue" : "0",
+         "numbins" : "100",
+         "binwidth" : "100"})
+
+sst.enableStatisticForComponentType("tcldbg.TclDbg",
+    "statTiming",
+        {"type":"sst.HistogramStatistic",
+         "minvalue" : "0",
+         "numbins" : "100",
+         "binwidth" : "10"})
+
+# EOF
@@ -0,0 +1,44 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tcldbg-test3.py
+#
+# Large, mostly static state dumped as full records (mmap) and as deltas
+# with periodic keyframes (delta). Both components hold identical state, so
+# every dumpPeriod dump must reconstruct to the same values:
+#   scripts/tdbg-reader.py mmap.tdbg --compare delta.tdbg
+# Reconstruct either file with
+#   scripts/tdbg-reader.py <component>.tdbg --cycle <n>
+#
+
+import sst
+
+for mode in ["mmap", "delta"]:
+  comp = sst.Component(mode, "tcldbg.TclDbg")
+  comp.addParams({
+    "verbose" : 5,
+    "minData" : 1000000,
+    "maxData" : 1000000,
+    "clockDelay" : 10,
+    "clocks" : 10000000,
+    "rngSeed" : 1223,
+    "clockFreq" : "1Ghz",
+    "dumpMode" : mode,
+    "updateWords" : 64,
+    "deltaChunk" : 256,
+    "keyframeInterval" : 16,
+    "dumpPeriod" : 1000000
+  })
+
+sst.setStatisticLoadLevel(10)
+sst.setStatisticOutput("sst.statOutputCSV")
+sst.enableStatisticForComponentType("tcldbg.TclDbg",
+    "statBytes", {"type":"sst.AccumulatorStatistic"})
+sst.enableStatisticForComponentType("tcldbg.TclDbg",
+    "statTiming", {"type":"sst.AccumulatorStatistic"})
+
+# EOF
@@ -0,0 +1,29 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tv-stress-test1.py
+#
+# self link only, one component per distribution
+#
+
+import os
+import sst
+
+for d in ["uniform", "exponential", "pareto", "constant"]:
+    c = sst.Component("tv_" + d, "tvstress.TvStress")
+    c.addParams({
+      "verbose"     : 1,
+      "depth"       : 64,
+      "delayDist"   : d,
+      "minDelay"    : 1,
+      "maxDelay"    : 10000,
+      "meanDelay"   : 100,
+      "stopTime"    : "100us",
+      "rngSeed"     : 3131
+    })
+
+# EOF
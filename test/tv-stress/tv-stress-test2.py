@@ -0,0 +1,43 @@
+#
+# Copyright (C) 2017-2026 Tactical Computing Laboratories, LLC
+# All Rights Reserved
+# contact@tactcomplabs.com
+#
+# See LICENSE in the top level directory for licensing details
+#
+# tv-stress-test2.py
+#
+# ring of components mixing self link and external link traffic
+#
+
+import os
+import sst
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputCSV", {"filepath" : "./tv-stress-test2.csv",
+                                             "separator" : ", " } )
+
+numComps = 8
+comps = []
+for i in range(numComps):
+    c = sst.Component("tv" + str(i), "tvstress.TvStress")
+    c.addParams({
+      "verbose"     : 1,
+      "numPorts"    : 2,
+      "depth"       : 32,
+      "delayDist"   : "exponential",
+      "meanDelay"   : 50,
+      "maxDelay"    : 5000,
+      "stopTime"    : "100us",
+      "rngSeed"     : 3131
+    })
+    comps.append(c)
+
+for i in range(numComps):
+    link = sst.Link("link" + str(i))
+    link.connect( (comps[i], "port0", "1ns"),
+                  (comps[(i+1) % numComps], "port1", "1ns") )
+
+sst.enableAllStatisticsForComponentType("tvstress.TvStress")
+
+# EOF